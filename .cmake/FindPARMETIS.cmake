@@ -0,0 +1,46 @@
+# -*- cmake -*-
+#
+# Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+#
+
+# - Try to find ParMETIS
+# Once done this will define
+#
+#  PARMETIS_FOUND        - system has ParMETIS
+#  PARMETIS_INCLUDE_DIRS - include directories for ParMETIS
+#  PARMETIS_LIBRARIES    - libraries for ParMETIS (and the METIS library it depends on)
+#
+# The variable PARMETIS_DIR (or the environment variable of the same name) can point to the
+# prefix directory of the ParMETIS installation
+
+find_path(PARMETIS_INCLUDE_DIR parmetis.h
+  HINTS ${PARMETIS_DIR} ENV PARMETIS_DIR
+  PATH_SUFFIXES include
+  DOC "Directory where the ParMETIS header files are located"
+)
+
+find_library(PARMETIS_LIBRARY
+  NAMES parmetis
+  HINTS ${PARMETIS_DIR} ENV PARMETIS_DIR
+  PATH_SUFFIXES lib
+  DOC "The ParMETIS library"
+)
+
+find_library(PARMETIS_METIS_LIBRARY
+  NAMES metis
+  HINTS ${PARMETIS_DIR} ENV PARMETIS_DIR ${METIS_DIR} ENV METIS_DIR
+  PATH_SUFFIXES lib
+  DOC "The METIS library ParMETIS depends on"
+)
+
+# Standard package handling
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(PARMETIS
+  REQUIRED_VARS PARMETIS_LIBRARY PARMETIS_METIS_LIBRARY PARMETIS_INCLUDE_DIR)
+
+if(PARMETIS_FOUND)
+  set(PARMETIS_LIBRARIES ${PARMETIS_LIBRARY} ${PARMETIS_METIS_LIBRARY})
+  set(PARMETIS_INCLUDE_DIRS ${PARMETIS_INCLUDE_DIR})
+endif()
+
+mark_as_advanced(PARMETIS_INCLUDE_DIR PARMETIS_LIBRARY PARMETIS_METIS_LIBRARY)
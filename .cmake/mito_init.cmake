@@ -137,6 +137,9 @@ function(mito_shareCmakePackage)
     # copy the {FindMETIS.cmake}
     install(FILES ${PROJECT_SOURCE_DIR}/.cmake/FindMETIS.cmake
             DESTINATION ${MITO_CMAKE_DIR})
+    # copy the {FindPARMETIS.cmake}
+    install(FILES ${PROJECT_SOURCE_DIR}/.cmake/FindPARMETIS.cmake
+            DESTINATION ${MITO_CMAKE_DIR})
 
     # create aliases matching the exports above
     add_library(mito::mito ALIAS mito)
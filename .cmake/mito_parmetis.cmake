@@ -0,0 +1,29 @@
+# -*- cmake -*-
+#
+# Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+#
+
+
+# ParMETIS support
+option(WITH_PARMETIS "Enable support for ParMetis" OFF)
+
+# if ParMETIS is requested
+if(WITH_PARMETIS)
+    # ParMETIS needs MPI
+    if(NOT WITH_MPI)
+        message(FATAL_ERROR "ParMetis support requires MPI support (WITH_MPI)")
+    endif()
+    # find ParMETIS
+    find_package(PARMETIS REQUIRED)
+    # report
+    message(STATUS "Enable ParMetis support")
+    # add compiler definitions
+    add_definitions(-DWITH_PARMETIS)
+    # include ParMETIS headers
+    target_include_directories(mito SYSTEM PUBLIC ${PARMETIS_INCLUDE_DIRS})
+    # link against ParMETIS libraries
+    target_link_libraries(mito PUBLIC ${PARMETIS_LIBRARIES})
+endif()
+
+
+# end of file
@@ -6,6 +6,7 @@
 # functions
 mito_test_driver(tests/mito.lib/functions/algebra.cc)
 mito_test_driver(tests/mito.lib/functions/function_from_functor.cc)
+mito_test_driver(tests/mito.lib/functions/batched_evaluation.cc)
 mito_test_driver(tests/mito.lib/functions/derivative_constants.cc)
 mito_test_driver(tests/mito.lib/functions/derivative_chain_rule.cc)
 mito_test_driver(tests/mito.lib/functions/derivative_higher_order.cc)
@@ -43,6 +44,8 @@ mito_test_driver(tests/mito.lib/constraints/dirichlet.cc)
 # discrete
 mito_test_driver(tests/mito.lib/discrete/point_field.cc)
 mito_test_driver(tests/mito.lib/discrete/mesh_field.cc)
+mito_test_driver(tests/mito.lib/discrete/dense_field.cc)
+mito_test_driver(tests/mito.lib/discrete/field_algebra.cc)
 
 # fem
 mito_test_driver(tests/mito.lib/fem/block_grad_grad.cc)
@@ -63,6 +66,17 @@ mito_test_driver(tests/mito.lib/io/summit_mesh_reader_2D.cc)
 mito_test_driver(tests/mito.lib/io/summit_mesh_reader_3D.cc)
 mito_test_driver(tests/mito.lib/io/summit_mesh_reader_segment_3D.cc)
 mito_test_driver(tests/mito.lib/io/summit_to_summit_mesh_2D.cc)
+mito_test_driver(tests/mito.lib/io/summit_mesh_writer_async_2D.cc)
+mito_test_driver(tests/mito.lib/io/binary_mesh_2D.cc)
+mito_test_driver(tests/mito.lib/io/vtu_mesh_writer_2D.cc)
+mito_test_driver(tests/mito.lib/io/xdmf_time_series_2D.cc)
+mito_test_driver(tests/mito.lib/io/checkpoint_2D.cc)
+mito_test_driver(tests/mito.lib/io/gmsh_mesh_reader_2D.cc)
+
+if(WITH_MPI)
+    mito_test_driver_mpi(tests/mito.lib/io/parallel_vtu_mesh_writer.cc 2)
+    mito_test_driver_mpi(tests/mito.lib/io/binary_partitioned_mesh_weak_scaling_mpi.cc 2)
+endif()
 
 if(WITH_VTK)
     mito_test_driver_pytest_check(tests/mito.lib/io/vtk_mesh_writer_2D.cc)
@@ -127,8 +141,10 @@ mito_test_driver(tests/mito.lib/math/permutation_sign.cc)
 
 # mesh
 mito_test_driver(tests/mito.lib/mesh/ball.cc)
+mito_test_driver(tests/mito.lib/mesh/boundary_lazy.cc)
 mito_test_driver(tests/mito.lib/mesh/build_mesh.cc)
 mito_test_driver(tests/mito.lib/mesh/erase_duplicates.cc)
+mito_test_driver(tests/mito.lib/mesh/erase_duplicates_patches.cc)
 mito_test_driver(tests/mito.lib/mesh/filter_ball.cc)
 mito_test_driver(tests/mito.lib/mesh/tetra_segment_1D.cc)
 mito_test_driver(tests/mito.lib/mesh/tetra_triangle_2D.cc)
@@ -139,18 +155,36 @@ mito_test_driver(tests/mito.lib/mesh/tetra_multiple_subdivisions.cc)
 mito_test_driver(tests/mito.lib/mesh/erase_element.cc)
 mito_test_driver(tests/mito.lib/mesh/sphere.cc)
 mito_test_driver(tests/mito.lib/mesh/summit_read_write.cc)
+mito_test_driver(tests/mito.lib/mesh/generators_rectangle.cc)
+mito_test_driver(tests/mito.lib/mesh/generators_box.cc)
+mito_test_driver(tests/mito.lib/mesh/bisect_triangle_2D.cc)
+mito_test_driver(tests/mito.lib/mesh/bisect_tetrahedron_3D.cc)
+mito_test_driver(tests/mito.lib/mesh/numbering.cc)
+
+if(WITH_MPI)
+    mito_test_driver_mpi(tests/mito.lib/mesh/generators_box_mpi.cc 2)
+    mito_test_driver_mpi(tests/mito.lib/mesh/distributed_partition_mpi.cc 3)
+    mito_test_driver_mpi(tests/mito.lib/mesh/distributed_ghost_mpi.cc 3)
+endif()
 
 if(WITH_METIS)
     mito_test_driver(tests/mito.lib/mesh/metis_partitioner.cc)
     mito_test_driver(tests/mito.lib/mesh/metis_partitioner_load_mesh.cc)
     mito_test_driver(tests/mito.lib/mesh/metis_partitioner_single_partition.cc)
+    mito_test_driver(tests/mito.lib/mesh/metis_partitioner_all.cc)
+    mito_test_driver(tests/mito.lib/mesh/metis_partitioner_weighted.cc)
 
     if(WITH_MPI)
         mito_test_driver_mpi(tests/mito.lib/mesh/metis_partitioner_mpi.cc 2)
         mito_test_driver_mpi(tests/mito.lib/mesh/metis_partitioner_mpi_load_mesh.cc 2)
+        mito_test_driver_mpi(tests/mito.lib/mesh/metis_partitioner_mpi_scatter.cc 2)
     endif()
 endif()
 
+# search
+mito_test_driver(tests/mito.lib/search/bvh_point_location.cc)
+mito_test_driver(tests/mito.lib/search/kd_tree_nearest.cc)
+
 # topology
 mito_test_driver(tests/mito.lib/topology/cell_edges.cc)
 mito_test_driver(tests/mito.lib/topology/erase_element_check_vertices.cc)
@@ -0,0 +1,16 @@
+# -*- cmake -*-
+#
+# Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+#
+
+
+# threads support
+
+# find the system threads library
+find_package(Threads REQUIRED)
+
+# link against the threads library
+target_link_libraries(mito PUBLIC Threads::Threads)
+
+
+# end of file
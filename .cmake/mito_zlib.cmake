@@ -0,0 +1,23 @@
+# -*- cmake -*-
+#
+# Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+#
+
+
+# zlib support
+option(WITH_ZLIB "Enable support for zlib compression" OFF)
+
+# if zlib is requested
+if(WITH_ZLIB)
+    # find zlib
+    find_package(ZLIB REQUIRED)
+    # report
+    message(STATUS "Enable zlib support")
+    # add compiler definitions
+    add_definitions(-DWITH_ZLIB)
+    # link against zlib
+    target_link_libraries(mito PUBLIC ZLIB::ZLIB)
+endif()
+
+
+# end of file
@@ -13,6 +13,9 @@
 // the type of coordinates
 using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
 
+// the number of points in a batch
+constexpr int batch_size = 1024;
+
 
 auto
 random_coordinate()
@@ -26,6 +29,24 @@ random_coordinate()
 }
 
 
+auto
+random_coordinates(int n)
+{
+    // a set of {n} random points in 2D space
+    std::vector<coordinates_t> points;
+    points.reserve(n);
+    for (int i = 0; i < n; ++i) {
+        // two random numbers
+        auto x = static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
+        auto y = static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
+        points.push_back(mito::geometry::coordinates<coordinates_t>({ x, y }));
+    }
+
+    // all done
+    return points;
+}
+
+
 auto
 laplacian_baseline(const coordinates_t & x)
 {
@@ -38,8 +59,8 @@ laplacian_baseline(const coordinates_t & x)
 }
 
 
-auto
-laplacian_mito(const coordinates_t & x)
+constexpr auto
+laplacian_field()
 {
     // the function extracting the x_0 component of 2D vector
     constexpr auto x0 = mito::functions::component<coordinates_t, 0>;
@@ -55,6 +76,17 @@ laplacian_mito(const coordinates_t & x)
     // the laplacian (divergence of gradient)
     constexpr auto laplacian = mito::fields::divergence(gradient);
 
+    // all done
+    return laplacian;
+}
+
+
+auto
+laplacian_mito(const coordinates_t & x)
+{
+    // the laplacian of {f}
+    constexpr auto laplacian = laplacian_field();
+
     // evaluate the laplacian at {x}
     auto result = laplacian(x);
 
@@ -87,11 +119,64 @@ LaplacianMito(benchmark::State & state)
     }
 }
 
+static void
+LaplacianMitoPointwise(benchmark::State & state)
+{
+    // the laplacian of {f}
+    constexpr auto laplacian = laplacian_field();
+
+    // generate a batch of random coordinates
+    auto points = random_coordinates(batch_size);
+    // the values of the laplacian at the points
+    std::vector<mito::tensor::scalar_t> values(batch_size);
+
+    // repeat the operation sufficient number of times
+    for (auto _ : state) {
+        // evaluate the laplacian point by point
+        for (int i = 0; i < batch_size; ++i) {
+            values[i] = laplacian(points[i]);
+        }
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+
+    // report the number of points evaluated
+    state.SetItemsProcessed(state.iterations() * batch_size);
+}
+
+static void
+LaplacianMitoBatch(benchmark::State & state)
+{
+    // the laplacian of {f}
+    constexpr auto laplacian = laplacian_field();
+
+    // generate a batch of random coordinates
+    auto points = random_coordinates(batch_size);
+    // the values of the laplacian at the points
+    std::vector<mito::tensor::scalar_t> values(batch_size);
+
+    // repeat the operation sufficient number of times
+    for (auto _ : state) {
+        // evaluate the laplacian on the whole batch
+        mito::functions::evaluate(
+            laplacian, std::span<const coordinates_t>(points), std::span(values));
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+
+    // report the number of points evaluated
+    state.SetItemsProcessed(state.iterations() * batch_size);
+}
+
 
 // run benchmark for laplacian calculation (baeline)
 BENCHMARK(LaplacianBaseline);
 // run benchmark for laplacian calculation (mito)
 BENCHMARK(LaplacianMito);
+// run benchmark for laplacian calculation on a batch of points, point by point (mito)
+BENCHMARK(LaplacianMitoPointwise);
+// run benchmark for laplacian calculation on a batch of points, all at once (mito)
+BENCHMARK(LaplacianMitoBatch);
 
 
 // run all benchmarks
@@ -0,0 +1,171 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// get the benchmark library
+#include <benchmark/benchmark.h>
+
+// get the mito io
+#include <mito/io.h>
+
+
+// the type of coordinates
+using coordinates_t = mito::geometry::coordinates_t<3, mito::geometry::CARTESIAN>;
+
+// the type of cell
+using cell_t = mito::geometry::tetrahedron_t<3>;
+
+// the number of copies of the ball mesh in the scaled up mesh
+constexpr int n_copies = 1000;
+
+// the scaled up mesh (run the benchmark from the directory holding {ball.summit}, e.g.
+// {tests/input})
+const std::string filename = "ball_scaled.summit";
+
+
+auto
+scale_up_ball()
+{
+    // read the ball mesh
+    std::ifstream fileStream("ball.summit");
+    int dim = 0;
+    int n_nodes = 0;
+    int n_cells = 0;
+    int n_cell_types = 0;
+    fileStream >> dim >> n_nodes >> n_cells >> n_cell_types;
+    std::vector<double> coordinates(dim * n_nodes);
+    for (auto & x : coordinates) {
+        fileStream >> x;
+    }
+    std::vector<int> cells(6 * n_cells);
+    for (auto & entry : cells) {
+        fileStream >> entry;
+    }
+
+    // write {n_copies} copies of it, side by side along the x axis
+    std::ofstream outfile(filename);
+    outfile << dim << "\n" << n_copies * n_nodes << " " << n_copies * n_cells << " 1\n";
+    outfile << std::setprecision(15);
+    for (int copy = 0; copy < n_copies; ++copy) {
+        for (int n = 0; n < n_nodes; ++n) {
+            outfile << coordinates[dim * n] + 3.0 * copy << " " << coordinates[dim * n + 1] << " "
+                    << coordinates[dim * n + 2] << "\n";
+        }
+    }
+    for (int copy = 0; copy < n_copies; ++copy) {
+        for (int e = 0; e < n_cells; ++e) {
+            // the cell type, the ids of the nodes and the cell set id
+            outfile << cells[6 * e];
+            for (int a = 1; a < 5; ++a) {
+                outfile << " " << cells[6 * e + a] + copy * n_nodes;
+            }
+            outfile << " " << cells[6 * e + 5] << "\n";
+        }
+    }
+
+    // all done
+    return;
+}
+
+
+auto
+reader_baseline(
+    std::ifstream & fileStream, mito::geometry::coordinate_system_t<coordinates_t> & coord_system)
+{
+    // read the heading
+    int dim = 0;
+    int n_nodes = 0;
+    int n_cells = 0;
+    int n_cell_types = 0;
+    fileStream >> dim >> n_nodes >> n_cells >> n_cell_types;
+
+    // read the nodes one token at a time
+    std::vector<mito::geometry::node_t<3>> nodes;
+    nodes.reserve(n_nodes);
+    for (int n = 0; n < n_nodes; ++n) {
+        mito::tensor::vector_t<3> x;
+        fileStream >> x[0] >> x[1] >> x[2];
+        nodes.push_back(mito::geometry::node(coord_system, coordinates_t(x)));
+    }
+
+    // read the cells one token at a time
+    auto mesh = mito::mesh::mesh<cell_t>();
+    for (int e = 0; e < n_cells; ++e) {
+        int type = 0;
+        std::array<int, 4> index;
+        std::string cell_set_id;
+        fileStream >> type >> index[0] >> index[1] >> index[2] >> index[3] >> cell_set_id;
+        mesh.insert(
+            { nodes[index[0] - 1], nodes[index[1] - 1], nodes[index[2] - 1],
+              nodes[index[3] - 1] });
+    }
+
+    // all done
+    return mesh;
+}
+
+
+static void
+SummitReaderBaseline(benchmark::State & state)
+{
+    // repeat the operation sufficient number of times
+    for (auto _ : state) {
+        auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+        std::ifstream fileStream(filename);
+        benchmark::DoNotOptimize(reader_baseline(fileStream, coord_system));
+    }
+}
+
+static void
+SummitReaderMito(benchmark::State & state)
+{
+    // repeat the operation sufficient number of times
+    for (auto _ : state) {
+        auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+        std::ifstream fileStream(filename);
+        benchmark::DoNotOptimize(mito::io::summit::reader<cell_t>(fileStream, coord_system));
+    }
+}
+
+static void
+BinaryReaderMito(benchmark::State & state)
+{
+    // convert the mesh to binary format
+    mito::io::binary::from_summit(filename, "ball_scaled");
+
+    // repeat the operation sufficient number of times
+    for (auto _ : state) {
+        auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+        benchmark::DoNotOptimize(
+            mito::io::binary::reader<cell_t>("ball_scaled.mito", coord_system));
+    }
+}
+
+
+// run benchmark for reading a summit mesh token by token (baseline)
+BENCHMARK(SummitReaderBaseline)->Unit(benchmark::kMillisecond)->Iterations(3);
+// run benchmark for reading a summit mesh (mito)
+BENCHMARK(SummitReaderMito)->Unit(benchmark::kMillisecond)->Iterations(3);
+// run benchmark for reading a binary mesh (mito)
+BENCHMARK(BinaryReaderMito)->Unit(benchmark::kMillisecond)->Iterations(3);
+
+
+// run all benchmarks
+int
+main(int argc, char ** argv)
+{
+    // generate the scaled up mesh
+    scale_up_ball();
+
+    // run the benchmarks
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    // all done
+    return 0;
+}
+
+
+// end of file
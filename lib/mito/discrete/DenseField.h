@@ -0,0 +1,173 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+// DESIGN NOTES
+// Class {DenseField} is the array-backed counterpart of {DiscreteField}: the values are stored
+// contiguously, one per key, in the order of the numbering of the keys given by a {DenseIndex}
+// (e.g. the numbering of the nodes of a mesh, which is also the order of the points in the vtk
+// writers). The values can be accessed by key (via a lookup in the index) or by number (without
+// lookups), and loops on all the values run on contiguous memory. The index is shared by all the
+// fields on the same keys, so that only one map from keys to numbers is stored.
+
+namespace mito::discrete {
+
+    template <class keyT, class valueT>
+    class DenseField {
+
+      public:
+        // the input type of the field
+        using input_type = keyT;
+        // the value type returned by the field
+        using value_type = valueT;
+        // the index type
+        using index_type = DenseIndex<input_type>;
+
+      private:
+        // iterator on the entries of the field, yielding pairs of references to a key and to its
+        // value (by value, so loops bind them with {auto &&} or {const auto &})
+        template <class fieldT, class referenceT>
+        class iterator_t {
+          public:
+            iterator_t(fieldT * field, int n) : _field(field), _n(n) {}
+
+            inline auto operator*() const -> std::pair<const input_type &, referenceT>
+            {
+                return { _field->index().key(_n), (*_field)[_n] };
+            }
+
+            inline auto operator++() -> iterator_t &
+            {
+                ++_n;
+                return *this;
+            }
+
+            inline auto operator==(const iterator_t & other) const -> bool
+            {
+                return _n == other._n;
+            }
+
+          private:
+            fieldT * _field;
+            int _n;
+        };
+
+        // the iterator types
+        using iterator = iterator_t<DenseField, value_type &>;
+        using const_iterator = iterator_t<const DenseField, const value_type &>;
+
+      public:
+        // constructor from a (shared) index on the keys
+        DenseField(std::shared_ptr<const index_type> index, std::string name) :
+            _index(index),
+            _values(index->size()),
+            _name(name)
+        {}
+
+        // destructor
+        ~DenseField() = default;
+
+        // delete copy constructor
+        DenseField(const DenseField &) = delete;
+
+        // default move constructor
+        DenseField(DenseField &&) = default;
+
+        // delete copy assignment
+        auto operator=(const DenseField &) -> DenseField & = delete;
+
+        // delete move assignment
+        auto operator=(DenseField &&) -> DenseField & = delete;
+
+      public:
+        /**
+         * accessor for the value of a given entry
+         */
+        inline auto operator()(const input_type & key) const -> const value_type &
+        {
+            return _values[(*_index)(key)];
+        }
+
+        /**
+         * mutator for the value of a given entry
+         */
+        inline auto operator()(const input_type & key) -> value_type &
+        {
+            return _values[(*_index)(key)];
+        }
+
+        /**
+         * accessor for the value of the entry with number {n}
+         */
+        inline auto operator[](int n) const -> const value_type &
+        {
+            assert(n >= 0 && n < size());
+            return _values[n];
+        }
+
+        /**
+         * mutator for the value of the entry with number {n}
+         */
+        inline auto operator[](int n) -> value_type &
+        {
+            assert(n >= 0 && n < size());
+            return _values[n];
+        }
+
+        /**
+         * accessor for the number of entries
+         */
+        inline auto size() const noexcept -> int { return std::size(_values); }
+
+        /**
+         * accessor for name
+         */
+        inline const std::string & name() const noexcept { return _name; }
+
+        /**
+         * accessor for the index of the keys
+         */
+        inline auto index() const noexcept -> const index_type & { return *_index; }
+
+        /**
+         * accessor for the shared index of the keys (e.g. to build another field on the same keys)
+         */
+        inline auto shared_index() const noexcept -> std::shared_ptr<const index_type>
+        {
+            return _index;
+        }
+
+        /**
+         * accessor for the values in the order of the numbering of the keys
+         */
+        inline auto values() const noexcept -> std::span<const value_type> { return _values; }
+        inline auto values() noexcept -> std::span<value_type> { return _values; }
+
+        // support for ranged for loops
+        inline auto begin() const { return const_iterator(this, 0); }
+        inline auto end() const { return const_iterator(this, size()); }
+        inline auto begin() { return iterator(this, 0); }
+        inline auto end() { return iterator(this, size()); }
+        inline auto cbegin() const { return begin(); }
+        inline auto cend() const { return end(); }
+
+      private:
+        // the numbering of the keys
+        std::shared_ptr<const index_type> _index;
+
+        // the values in the order of the numbering of the keys
+        std::vector<value_type> _values;
+
+        // the name of the field
+        std::string _name;
+    };
+
+}    // namespace mito
+
+
+// end of file
@@ -0,0 +1,88 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::discrete {
+
+    // a dense numbering 0, ..., size() - 1 of a collection of keys (e.g. the nodes or the cells of
+    // a mesh, the points of a cloud, the discretization nodes of a function space), in the order
+    // the keys are given, together with the map from each key to its number
+    // An index is shared by all the dense fields defined on the same keys
+    template <class keyT>
+    class DenseIndex {
+
+      public:
+        // the key type
+        using key_type = keyT;
+
+      private:
+        // a map from {key_type} to numbers
+        using map_type = std::unordered_map<key_type, int, utilities::hash_function<key_type>>;
+
+      public:
+        // constructor from a collection of keys (repeated keys are numbered once)
+        template <class keysCollectionT>
+        DenseIndex(const keysCollectionT & keys) : _keys(), _numbers()
+        {
+            // number the keys in the order they are given
+            for (const auto & key : keys) {
+                if (_numbers.emplace(key, std::size(_keys)).second) {
+                    _keys.push_back(key);
+                }
+            }
+        }
+
+        // destructor
+        ~DenseIndex() = default;
+
+        // delete copy constructor
+        DenseIndex(const DenseIndex &) = delete;
+
+        // default move constructor
+        DenseIndex(DenseIndex &&) = default;
+
+        // delete copy assignment
+        auto operator=(const DenseIndex &) -> DenseIndex & = delete;
+
+        // delete move assignment
+        auto operator=(DenseIndex &&) -> DenseIndex & = delete;
+
+      public:
+        // the number of keys
+        inline auto size() const noexcept -> int { return std::size(_keys); }
+
+        // the number of {key}
+        inline auto operator()(const key_type & key) const -> int { return _numbers.at(key); }
+
+        // the number of {key}, or -1 if {key} is not in the index
+        inline auto find(const key_type & key) const -> int
+        {
+            auto entry = _numbers.find(key);
+            return entry == std::end(_numbers) ? -1 : entry->second;
+        }
+
+        // whether {key} is in the index
+        inline auto contains(const key_type & key) const -> bool { return _numbers.contains(key); }
+
+        // the key with number {n}
+        inline auto key(int n) const -> const key_type & { return _keys[n]; }
+
+        // the keys in the order of their numbers
+        inline auto keys() const noexcept -> const std::vector<key_type> & { return _keys; }
+
+      private:
+        // the keys in the order of their numbers
+        std::vector<key_type> _keys;
+        // the number of each key
+        map_type _numbers;
+    };
+
+}    // namespace mito
+
+
+// end of file
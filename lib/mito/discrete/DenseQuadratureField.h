@@ -0,0 +1,153 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+// DESIGN NOTES
+// Class {DenseQuadratureField} stores {Q} values per cell, one per quadrature point (e.g. the
+// coordinates of the quadrature points, or the state of a material), in a single array laid out
+// as [cell][quadrature point], with each value holding its components, and aligned to a cache
+// line. The cells are numbered densely by a {DenseIndex}, shared by all the quadrature fields on
+// the same cells, so that loops on the cells in the order of their numbers stream through
+// contiguous memory without lookups.
+
+namespace mito::discrete {
+
+    template <class keyT, int Q, class valueT>
+    class DenseQuadratureField {
+
+      public:
+        // the input type of the field
+        using input_type = keyT;
+        // the value type at a quadrature point
+        using value_type = valueT;
+        // the index type
+        using index_type = DenseIndex<input_type>;
+        // the number of quadrature points per cell
+        static constexpr int n_points = Q;
+
+      public:
+        // constructor from a (shared) index on the cells
+        DenseQuadratureField(std::shared_ptr<const index_type> index, std::string name) :
+            _index(index),
+            _values(Q * index->size()),
+            _name(name)
+        {}
+
+        // destructor
+        ~DenseQuadratureField() = default;
+
+        // delete copy constructor
+        DenseQuadratureField(const DenseQuadratureField &) = delete;
+
+        // default move constructor
+        DenseQuadratureField(DenseQuadratureField &&) = default;
+
+        // delete copy assignment
+        auto operator=(const DenseQuadratureField &) -> DenseQuadratureField & = delete;
+
+        // delete move assignment
+        auto operator=(DenseQuadratureField &&) -> DenseQuadratureField & = delete;
+
+      public:
+        /**
+         * accessor for the values at the quadrature points of a given cell
+         */
+        inline auto operator()(const input_type & key) const -> std::span<const value_type, Q>
+        {
+            return (*this)[(*_index)(key)];
+        }
+
+        /**
+         * mutator for the values at the quadrature points of a given cell
+         */
+        inline auto operator()(const input_type & key) -> std::span<value_type, Q>
+        {
+            return (*this)[(*_index)(key)];
+        }
+
+        /**
+         * accessor for the values at the quadrature points of the cell with number {e}
+         */
+        inline auto operator[](int e) const -> std::span<const value_type, Q>
+        {
+            assert(e >= 0 && e < size());
+            return std::span<const value_type, Q>(_values.data() + Q * e, Q);
+        }
+
+        /**
+         * mutator for the values at the quadrature points of the cell with number {e}
+         */
+        inline auto operator[](int e) -> std::span<value_type, Q>
+        {
+            assert(e >= 0 && e < size());
+            return std::span<value_type, Q>(_values.data() + Q * e, Q);
+        }
+
+        /**
+         * accessor for the value at the {q}-th quadrature point of the cell with number {e}
+         */
+        inline auto operator()(int e, int q) const -> const value_type &
+        {
+            assert(e >= 0 && e < size() && q >= 0 && q < Q);
+            return _values[Q * e + q];
+        }
+
+        /**
+         * mutator for the value at the {q}-th quadrature point of the cell with number {e}
+         */
+        inline auto operator()(int e, int q) -> value_type &
+        {
+            assert(e >= 0 && e < size() && q >= 0 && q < Q);
+            return _values[Q * e + q];
+        }
+
+        /**
+         * accessor for the number of cells
+         */
+        inline auto size() const noexcept -> int { return _index->size(); }
+
+        /**
+         * accessor for name
+         */
+        inline const std::string & name() const noexcept { return _name; }
+
+        /**
+         * accessor for the index of the cells
+         */
+        inline auto index() const noexcept -> const index_type & { return *_index; }
+
+        /**
+         * accessor for the shared index of the cells (e.g. to build another field on the same
+         * cells)
+         */
+        inline auto shared_index() const noexcept -> std::shared_ptr<const index_type>
+        {
+            return _index;
+        }
+
+        /**
+         * accessor for the values at all the quadrature points, laid out as [cell][point]
+         */
+        inline auto values() const noexcept -> std::span<const value_type> { return _values; }
+        inline auto values() noexcept -> std::span<value_type> { return _values; }
+
+      private:
+        // the numbering of the cells
+        std::shared_ptr<const index_type> _index;
+
+        // the values at the quadrature points
+        utilities::aligned_vector_t<value_type> _values;
+
+        // the name of the field
+        std::string _name;
+    };
+
+}    // namespace mito
+
+
+// end of file
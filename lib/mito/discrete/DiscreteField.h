@@ -31,6 +31,11 @@ namespace mito::discrete {
         template <class keysCollectionT>
         DiscreteField(const keysCollectionT & keys, std::string name) : DiscreteField(name)
         {
+            // make room for the keys, if their number is known
+            if constexpr (std::ranges::sized_range<keysCollectionT>) {
+                _map_entry_to_values.reserve(std::ranges::size(keys));
+            }
+
             // populate the map with the keys and default values for entries
             for (const auto & key : keys) {
                 insert(key);
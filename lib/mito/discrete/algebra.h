@@ -0,0 +1,329 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+// DESIGN NOTES
+// The algebra of discrete fields works on fields storing their values contiguously (dense fields,
+// dense quadrature fields and finite element fields on dense nodal fields). Arithmetic operators
+// on fields do not compute anything: they build a lightweight {FieldExpression} that evaluates
+// the entries of the result one at a time. The expression is evaluated by {assign}, in a single
+// pass over the values of the operands (e.g. {u = a * u + b * v} reads each entry of {u} and {v}
+// once and writes each entry of {u} once), with the loop split in contiguous chunks over the
+// threads and the operations inlined in the body of the loop, so that the compiler can vectorize
+// it.
+// The reductions ({sum}, {dot}, {norm_l2}, {norm_max}) add up the entries in blocks of fixed
+// size, which are reduced concurrently and then combined in the order of the blocks, so that the
+// result is bitwise the same regardless of the number of threads.
+
+namespace mito::discrete {
+
+    // a view of the values of a field stored contiguously, the leaf of a field expression
+    template <class valueT>
+    class FieldView {
+
+      public:
+        // the type of the entries
+        using value_type = valueT;
+
+      public:
+        // constructor
+        constexpr FieldView(std::span<const value_type> values) : _values(values) {}
+
+      public:
+        // the number of entries
+        constexpr auto size() const noexcept -> int { return std::size(_values); }
+
+        // the {i}-th entry
+        constexpr auto operator[](int i) const -> const value_type & { return _values[i]; }
+
+      private:
+        // the values
+        std::span<const value_type> _values;
+    };
+
+    // the entrywise {operation} applied to the entries of the {operands}
+    template <class operationT, class... operandsT>
+    class FieldExpression {
+
+      public:
+        // the type of the entries
+        using value_type = std::decay_t<
+            std::invoke_result_t<const operationT &, typename operandsT::value_type...>>;
+
+      public:
+        // constructor
+        constexpr FieldExpression(operationT operation, operandsT... operands) :
+            _operation(operation),
+            _operands(operands...)
+        {
+            // the number of entries of the first operand
+            int size = std::get<0>(_operands).size();
+
+            // check that all the operands have the same number of entries
+            if (((operands.size() != size) || ...)) {
+                throw std::runtime_error("discrete: Operands have different sizes");
+            }
+        }
+
+      public:
+        // the number of entries
+        constexpr auto size() const noexcept -> int { return std::get<0>(_operands).size(); }
+
+        // the {i}-th entry
+        constexpr auto operator[](int i) const -> value_type
+        {
+            return std::apply(
+                [this, i](const auto &... operand) { return _operation(operand[i]...); },
+                _operands);
+        }
+
+      private:
+        // the operation
+        operationT _operation;
+        // the operands
+        std::tuple<operandsT...> _operands;
+    };
+
+    // concept of a field storing its values contiguously
+    template <class F>
+    concept dense_storage_c = requires(F & f) {
+        // dense fields and dense quadrature fields
+        { f.values() };
+    } || requires(F & f) {
+        // finite element fields on dense nodal fields
+        { f.nodal_values().values() };
+    };
+
+    // concept of a field expression
+    template <class F>
+    concept field_expression_c = requires(const F & f) {
+        // require that F only binds to {FieldView} or {FieldExpression} specializations
+        []<class valueT>(const FieldView<valueT> &) {
+        }(f);
+    } || requires(const F & f) {
+        []<class operationT, class... operandsT>(
+            const FieldExpression<operationT, operandsT...> &) {
+        }(f);
+    };
+
+    // concept of an operand of the algebra of fields
+    template <class F>
+    concept field_operand_c = dense_storage_c<F> || field_expression_c<F>;
+
+    // the contiguous values of {field}
+    template <dense_storage_c fieldT>
+    constexpr auto values(fieldT & field)
+    {
+        if constexpr (requires { field.values(); }) {
+            return field.values();
+        } else {
+            return field.nodal_values().values();
+        }
+    }
+
+    // the expression of {operand}
+    template <field_operand_c operandT>
+    constexpr auto expression(const operandT & operand)
+    {
+        if constexpr (field_expression_c<operandT>) {
+            return operand;
+        } else {
+            auto view = values(operand);
+            return FieldView<typename decltype(view)::value_type>(view);
+        }
+    }
+
+    // the sum of two fields
+    template <field_operand_c F1, field_operand_c F2>
+    constexpr auto operator+(const F1 & f1, const F2 & f2)
+    {
+        return FieldExpression(
+            [](const auto & a, const auto & b) { return a + b; }, expression(f1), expression(f2));
+    }
+
+    // the difference of two fields
+    template <field_operand_c F1, field_operand_c F2>
+    constexpr auto operator-(const F1 & f1, const F2 & f2)
+    {
+        return FieldExpression(
+            [](const auto & a, const auto & b) { return a - b; }, expression(f1), expression(f2));
+    }
+
+    // the opposite of a field
+    template <field_operand_c F>
+    constexpr auto operator-(const F & f)
+    {
+        return FieldExpression([](const auto & a) { return -a; }, expression(f));
+    }
+
+    // the product of a field by a scalar
+    template <field_operand_c F>
+    constexpr auto operator*(tensor::scalar_t a, const F & f)
+    {
+        return FieldExpression([a](const auto & b) { return a * b; }, expression(f));
+    }
+
+    // the product of a field by a scalar
+    template <field_operand_c F>
+    constexpr auto operator*(const F & f, tensor::scalar_t a)
+    {
+        return a * f;
+    }
+
+    // the division of a field by a scalar
+    template <field_operand_c F>
+    constexpr auto operator/(const F & f, tensor::scalar_t a)
+    {
+        return (1.0 / a) * f;
+    }
+
+    // evaluate {operand} (e.g. a field expression) into the values of {field}
+    template <dense_storage_c fieldT, field_operand_c operandT>
+    auto assign(fieldT & field, const operandT & operand) -> void
+    {
+        // the values of the field and the expression of the operand
+        auto result = values(field);
+        auto source = expression(operand);
+
+        // check that the sizes match
+        if (std::ssize(result) != source.size()) {
+            throw std::runtime_error("discrete: Operands have different sizes");
+        }
+
+        // evaluate the expression in a single pass, on contiguous chunks concurrently
+        utilities::parallel_for(0, source.size(), [&result, &source](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                result[i] = source[i];
+            }
+        });
+
+        // all done
+        return;
+    }
+
+    namespace {
+        // the number of entries per block of a reduction
+        constexpr int reduction_block_size = 4096;
+
+        // combine with {combine} the values {value(i)} of {n} entries, starting from {init}
+        // The entries are reduced in blocks of fixed size, concurrently, and the results of the
+        // blocks are combined in order, so the result does not depend on the number of threads
+        template <class resultT, class valueT, class combineT>
+        auto reduce_in_blocks(int n, resultT init, valueT && value, combineT && combine) -> resultT
+        {
+            // the number of blocks
+            int n_blocks = (n + reduction_block_size - 1) / reduction_block_size;
+
+            // reduce each block
+            std::vector<resultT> partials(n_blocks, init);
+            utilities::parallel_for(
+                0, n_blocks,
+                [&](int begin, int end) {
+                    for (int block = begin; block < end; ++block) {
+                        int first = block * reduction_block_size;
+                        int last = std::min(first + reduction_block_size, n);
+                        auto partial = init;
+                        for (int i = first; i < last; ++i) {
+                            partial = combine(partial, value(i));
+                        }
+                        partials[block] = partial;
+                    }
+                },
+                1);
+
+            // combine the blocks in order
+            auto result = init;
+            for (const auto & partial : partials) {
+                result = combine(result, partial);
+            }
+
+            // all done
+            return result;
+        }
+
+        // the inner product of two entries
+        template <class Y>
+        constexpr auto inner(const Y & a, const Y & b) -> tensor::scalar_t
+        {
+            if constexpr (std::is_arithmetic_v<Y>) {
+                return a * b;
+            } else {
+                tensor::scalar_t result = 0.0;
+                for (int k = 0; k < Y::size; ++k) {
+                    result += std::begin(a)[k] * std::begin(b)[k];
+                }
+                return result;
+            }
+        }
+
+        // the magnitude of an entry
+        template <class Y>
+        constexpr auto magnitude(const Y & a) -> tensor::scalar_t
+        {
+            if constexpr (std::is_arithmetic_v<Y>) {
+                return std::abs(a);
+            } else {
+                return std::sqrt(inner(a, a));
+            }
+        }
+    }
+
+    // the sum of the entries of {operand}
+    template <field_operand_c operandT>
+    auto sum(const operandT & operand)
+    {
+        // the expression of the operand
+        auto source = expression(operand);
+
+        // add up the entries
+        return reduce_in_blocks(
+            source.size(), typename decltype(source)::value_type{},
+            [&source](int i) { return source[i]; },
+            [](const auto & a, const auto & b) { return a + b; });
+    }
+
+    // the inner product of {operand_1} and {operand_2} (the sum of the inner products of their
+    // entries)
+    template <field_operand_c operand1T, field_operand_c operand2T>
+    auto dot(const operand1T & operand_1, const operand2T & operand_2) -> tensor::scalar_t
+    {
+        // the expressions of the operands
+        auto source = FieldExpression(
+            [](const auto & a, const auto & b) { return inner(a, b); }, expression(operand_1),
+            expression(operand_2));
+
+        // add up the inner products of the entries
+        return reduce_in_blocks(
+            source.size(), tensor::scalar_t{ 0.0 }, [&source](int i) { return source[i]; },
+            [](tensor::scalar_t a, tensor::scalar_t b) { return a + b; });
+    }
+
+    // the l2 norm of {operand} (the square root of the sum of the squared entries)
+    template <field_operand_c operandT>
+    auto norm_l2(const operandT & operand) -> tensor::scalar_t
+    {
+        return std::sqrt(dot(operand, operand));
+    }
+
+    // the max norm of {operand} (the largest magnitude of an entry)
+    template <field_operand_c operandT>
+    auto norm_max(const operandT & operand) -> tensor::scalar_t
+    {
+        // the expression of the operand
+        auto source = expression(operand);
+
+        // find the largest magnitude of an entry
+        return reduce_in_blocks(
+            source.size(), tensor::scalar_t{ 0.0 },
+            [&source](int i) { return magnitude(source[i]); },
+            [](tensor::scalar_t a, tensor::scalar_t b) { return std::max(a, b); });
+    }
+}
+
+
+// end of file
@@ -28,6 +28,26 @@ namespace mito::discrete {
     template <class cellT, int Q, class Y>
     using quadrature_field_t = DiscreteField<cellT, std::array<Y, Q>>;
 
+    // dense index alias
+    template <class keyT>
+    using dense_index_t = DenseIndex<keyT>;
+
+    // dense field alias
+    template <class keyT, class Y>
+    using dense_field_t = DenseField<keyT, Y>;
+
+    // dense mesh field
+    template <int D, class Y>
+    using dense_mesh_field_t = DenseField<geometry::node_t<D>, Y>;
+
+    // dense nodal field
+    template <class Y>
+    using dense_nodal_field_t = DenseField<discretization_node_t, Y>;
+
+    // dense quadrature field alias
+    template <class cellT, int Q, class Y>
+    using dense_quadrature_field_t = DenseQuadratureField<cellT, Q, Y>;
+
     // quadrature field factory
     template <class Y, int Q, mesh::mesh_c meshT>
     constexpr auto quadrature_field(const meshT & mesh, std::string name);
@@ -46,6 +66,39 @@ namespace mito::discrete {
     template <class Y, geometry::point_cloud_c cloudT>
     constexpr auto point_field(const cloudT & cloud, std::string name);
 
+    // point field factory from a continuous field
+    template <fields::field_c fieldT, geometry::point_cloud_c cloudT>
+    constexpr auto point_field(
+        const cloudT & cloud, const geometry::coordinate_system_c auto & coord_system,
+        const fieldT & field, std::string name);
+
+    // dense index factory
+    template <class keysCollectionT>
+    auto dense_index(const keysCollectionT & keys);
+
+    // dense field factory on a (shared) index
+    template <class Y, class keyT>
+    auto dense_field(std::shared_ptr<const dense_index_t<keyT>> index, std::string name);
+
+    // dense quadrature field factory on a (shared) index
+    template <class Y, int Q, class cellT>
+    auto dense_quadrature_field(
+        std::shared_ptr<const dense_index_t<cellT>> index, std::string name);
+
+    // dense quadrature field factory
+    template <class Y, int Q, mesh::mesh_c meshT>
+    auto dense_quadrature_field(const meshT & mesh, std::string name);
+
+    // dense mesh field factory
+    template <class Y, mesh::mesh_c meshT>
+    auto dense_mesh_field(const meshT & mesh, std::string name);
+
+    // dense mesh field factory from a continuous field
+    template <fields::field_c fieldT>
+    auto dense_mesh_field(
+        const mesh::mesh_c auto & mesh, const geometry::coordinate_system_c auto & coord_system,
+        const fieldT & field, std::string name);
+
 }
 
 
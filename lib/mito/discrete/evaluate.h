@@ -0,0 +1,99 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::discrete {
+
+    // evaluate the continuous {field} at {n} positions, writing the value at the {i}-th position,
+    // with coordinates {coordinates(i)}, to {value(i)}
+    // The positions are split in contiguous chunks evaluated concurrently; within each chunk the
+    // coordinates are first gathered in a contiguous batch, which is then evaluated at once with
+    // {functions::evaluate}; {coordinates} and {value} are called concurrently, so they must
+    // neither modify shared data nor copy shared pointers
+    template <fields::field_c fieldT, class coordinatesT, class valueT>
+    auto evaluate(const fieldT & field, int n, coordinatesT && coordinates, valueT && value)
+        -> void
+    {
+        // the number of positions per batch
+        static constexpr int batch_size = 256;
+
+        // evaluate the chunks of positions concurrently
+        utilities::parallel_for(0, n, [&field, &coordinates, &value](int begin, int end) {
+            // the coordinates of a batch of positions and the values of the field at them
+            std::vector<typename fieldT::input_type> batch;
+            std::vector<typename fieldT::output_type> values;
+            batch.reserve(std::min(batch_size, end - begin));
+
+            // loop on the batches of this chunk
+            for (int first = begin; first < end; first += batch_size) {
+                // the end of the batch
+                int last = std::min(first + batch_size, end);
+
+                // gather the coordinates of the positions
+                batch.clear();
+                for (int i = first; i < last; ++i) {
+                    batch.push_back(coordinates(i));
+                }
+
+                // evaluate the field on the batch
+                values.resize(std::size(batch));
+                functions::evaluate(
+                    field, std::span<const typename fieldT::input_type>(batch), std::span(values));
+
+                // scatter the values of the field
+                for (int i = first; i < last; ++i) {
+                    value(i) = values[i - first];
+                }
+            }
+        });
+
+        // all done
+        return;
+    }
+
+    // evaluate the continuous {field} at the nodes (or points) of the discrete field {d_field},
+    // with the coordinates of each node given by {coord_system}, in parallel
+    template <fields::field_c fieldT, class discreteFieldT>
+    auto evaluate(
+        const fieldT & field, const geometry::coordinate_system_c auto & coord_system,
+        discreteFieldT & d_field) -> void
+    {
+        // the input and value types of the discrete field
+        using input_type = typename discreteFieldT::input_type;
+        using value_type = typename discreteFieldT::value_type;
+
+        // collect the entries of the field (without copying the shared pointers to the keys)
+        std::vector<std::pair<const input_type *, value_type *>> entries;
+        entries.reserve(d_field.size());
+        for (auto && [key, value] : d_field) {
+            entries.emplace_back(&key, &value);
+        }
+
+        // the coordinates of the key of the {i}-th entry
+        auto _coordinates = [&coord_system, &entries](int i) -> const auto & {
+            if constexpr (requires(const input_type & key) { key->point(); }) {
+                // the key is a node
+                return coord_system.coordinates((*entries[i].first)->point());
+            } else {
+                // the key is a point
+                return coord_system.coordinates(*entries[i].first);
+            }
+        };
+
+        // evaluate {field} at the entries
+        evaluate(field, std::size(entries), _coordinates, [&entries](int i) -> value_type & {
+            return *entries[i].second;
+        });
+
+        // all done
+        return;
+    }
+}
+
+
+// end of file
@@ -10,6 +10,17 @@
 // externals
 #include <string>
 #include <cassert>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 // support
 #include "../mesh.h"
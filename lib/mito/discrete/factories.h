@@ -44,12 +44,7 @@ namespace mito::discrete {
         auto m_field = mesh_field<typename fieldT::output_type>(mesh, name);
 
         // populate the mesh field with the values of the continuous field
-        for (auto & [node, value] : m_field) {
-            // get the position of {node}
-            auto coord = coord_system.coordinates(node->point());
-            // evaluate the continuousfield at {coord}
-            value = field(coord);
-        }
+        evaluate(field, coord_system, m_field);
 
         // return the mesh field
         return m_field;
@@ -63,6 +58,99 @@ namespace mito::discrete {
         return point_field_t<cloudT::dim, Y>(cloud.points(), name);
     }
 
+    // point field factory from a continuous field
+    template <fields::field_c fieldT, geometry::point_cloud_c cloudT>
+    constexpr auto point_field(
+        const cloudT & cloud, const geometry::coordinate_system_c auto & coord_system,
+        const fieldT & field, std::string name)
+    {
+        // create a point field on the cloud
+        auto p_field = point_field<typename fieldT::output_type>(cloud, name);
+
+        // populate the point field with the values of the continuous field
+        evaluate(field, coord_system, p_field);
+
+        // return the point field
+        return p_field;
+    }
+
+    // dense index factory
+    template <class keysCollectionT>
+    auto dense_index(const keysCollectionT & keys)
+    {
+        // the key type
+        using key_type = std::decay_t<decltype(*std::begin(keys))>;
+
+        // number the keys in the order they are given
+        return std::shared_ptr<const dense_index_t<key_type>>(
+            std::make_shared<dense_index_t<key_type>>(keys));
+    }
+
+    // dense field factory on a (shared) index
+    template <class Y, class keyT>
+    auto dense_field(std::shared_ptr<const dense_index_t<keyT>> index, std::string name)
+    {
+        // build a dense field on the keys of the index
+        return dense_field_t<keyT, Y>(index, name);
+    }
+
+    // dense quadrature field factory on a (shared) index
+    template <class Y, int Q, class cellT>
+    auto dense_quadrature_field(std::shared_ptr<const dense_index_t<cellT>> index, std::string name)
+    {
+        // build a dense quadrature field on the cells of the index ({Q} quad points per cell)
+        return dense_quadrature_field_t<cellT, Q, Y>(index, name);
+    }
+
+    // dense quadrature field factory
+    template <class Y, int Q, mesh::mesh_c meshT>
+    auto dense_quadrature_field(const meshT & mesh, std::string name)
+    {
+        // collect the cells in the order of iteration on the cells of the mesh
+        std::vector<typename meshT::cell_type::simplex_type> cells;
+        cells.reserve(mesh.nCells());
+        for (const auto & cell : mesh.cells()) {
+            cells.push_back(cell.simplex());
+        }
+
+        // build a dense quadrature field on the cells ({Q} quad points per cell)
+        return dense_quadrature_field<Y, Q>(dense_index(cells), name);
+    }
+
+    // dense mesh field factory
+    template <class Y, mesh::mesh_c meshT>
+    auto dense_mesh_field(const meshT & mesh, std::string name)
+    {
+        // number the nodes of the mesh (in the order of the points of the vtk writers)
+        auto numbering = mesh::node_numbering(mesh);
+
+        // collect the nodes in the order of their numbers
+        std::vector<geometry::node_t<meshT::dim>> nodes;
+        nodes.reserve(numbering.size());
+        for (int n = 0; n < numbering.size(); ++n) {
+            nodes.push_back(numbering.node(n));
+        }
+
+        // build a dense mesh field on the nodes
+        return dense_field<Y>(dense_index(nodes), name);
+    }
+
+    // dense mesh field factory from a continuous field
+    template <fields::field_c fieldT>
+    auto dense_mesh_field(
+        const mesh::mesh_c auto & mesh, const geometry::coordinate_system_c auto & coord_system,
+        const fieldT & field, std::string name)
+    {
+        // create a dense mesh field on the mesh
+        auto m_field = dense_mesh_field<typename fieldT::output_type>(mesh, name);
+
+        // populate the mesh field with the values of the continuous field
+        evaluate(field, coord_system, m_field);
+
+        // return the mesh field
+        return m_field;
+    }
+
 }
 
 
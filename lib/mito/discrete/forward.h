@@ -15,6 +15,18 @@ namespace mito::discrete {
     // class discrete field
     template <class keyT, class Y>
     class DiscreteField;
+
+    // class dense index
+    template <class keyT>
+    class DenseIndex;
+
+    // class dense field
+    template <class keyT, class Y>
+    class DenseField;
+
+    // class dense quadrature field
+    template <class keyT, int Q, class Y>
+    class DenseQuadratureField;
 }
 
 
@@ -18,8 +18,17 @@
 
 // classes implementation
 #include "DiscreteField.h"
+#include "DenseIndex.h"
+#include "DenseField.h"
+#include "DenseQuadratureField.h"
 #include "DiscretizationNode.h"
 
+// evaluation of continuous fields on discrete fields
+#include "evaluate.h"
+
+// algebra of discrete fields
+#include "algebra.h"
+
 // factories implementation
 #include "factories.h"
 
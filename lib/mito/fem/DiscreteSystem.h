@@ -69,6 +69,46 @@ namespace mito::fem {
             return;
         }
 
+        // constructor from the equation numbers {equations} of the discretization nodes (in the
+        // order given by {number_discretization_nodes}, -1 for the constrained nodes), e.g. as
+        // restored from a checkpoint
+        DiscreteSystem(
+            const label_type & label, const function_space_type & function_space,
+            const weakform_type & weakform, std::span<const int> equations) :
+            _function_space(function_space),
+            _weakform(weakform),
+            _equation_map(),
+            _solution_field(
+                function_space.template fem_field<solution_field_type>(label + ".solution")),
+            _linear_system(label)
+        {
+            // make a channel
+            journal::info_t channel("discretization.discrete_system");
+
+            // the discretization nodes in the order of their numbers
+            auto nodes = number_discretization_nodes(function_space).first;
+
+            // check that there is one equation number per node
+            if (std::size(equations) != std::size(nodes)) {
+                throw std::runtime_error("discrete system: Wrong number of equation numbers");
+            }
+
+            // restore the equation map and count the equations
+            for (int n = 0; n < std::ssize(nodes); ++n) {
+                _equation_map.emplace(nodes[n], equations[n]);
+                _n_equations = std::max(_n_equations, equations[n] + 1);
+            }
+
+            // print the number of equations
+            channel << "Number of equations: " << _n_equations << journal::endl;
+
+            // create the linear system and allocate the memory
+            _linear_system.create(_n_equations);
+
+            // all done
+            return;
+        }
+
         // destructor
         constexpr ~DiscreteSystem() = default;
 
@@ -187,6 +227,16 @@ namespace mito::fem {
 
         // read the solution nodal field
         constexpr void read_solution()
+        {
+            // read the solution into the solution field
+            return read_solution(_solution_field);
+        }
+
+        // read the solution into the finite element field {field} (e.g. a field with the nodal
+        // values stored contiguously, see {FunctionSpace::dense_fem_field})
+        template <class nodalFieldT>
+        constexpr void read_solution(
+            FemField<solution_field_type, function_space_type, nodalFieldT> & field)
         {
             // check that the number of equations matches that of the linear system
             assert(_n_equations == _linear_system.n_equations());
@@ -197,13 +247,11 @@ namespace mito::fem {
 
             // TODO: ask the function space to populate the constrained nodes appropriately
 
-            // get the node map from the function space
-            auto node_map = _function_space.node_map();
             // fill information in finite element field
             for (auto & [node, eq] : _equation_map) {
                 if (eq != -1) {
                     // note the solution on the solution field
-                    _solution_field(node) = u[eq];
+                    field(node) = u[eq];
                 }
             }
 
@@ -217,6 +265,15 @@ namespace mito::fem {
             return _solution_field;
         }
 
+        // accessor to the solution finite element field (e.g. to restore it from a checkpoint)
+        constexpr auto solution() noexcept -> fem_field_type & { return _solution_field; }
+
+        // accessor to the equation map
+        constexpr auto equation_map() const noexcept -> const equation_map_type &
+        {
+            return _equation_map;
+        }
+
         // accessor to the number of equations
         constexpr auto n_equations() const noexcept -> int { return _n_equations; }
 
@@ -12,19 +12,22 @@
 // discretization nodes. The field can be localized on finite elements via the {localize} method,
 // which assembles the field values on the element from the nodal values and the element shape
 // functions.
+// The nodal values are stored in a {DiscreteField} by default, or in any other field keyed by the
+// discretization nodes, e.g. a {DenseField} with the values stored contiguously in the order of
+// the numbering of the discretization nodes.
 
 namespace mito::fem {
 
     // TODO: implement higher-dimensional fields (e.g. vector fields, tensor fields, ...)
 
-    template <class fieldValueT, class functionSpaceT>
+    template <class fieldValueT, class functionSpaceT, class nodalFieldT>
     class FemField {
 
       private:
         // the field value type
         using field_value_type = fieldValueT;
         // the nodal field type
-        using nodal_field_type = discrete::nodal_field_t<field_value_type>;
+        using nodal_field_type = nodalFieldT;
         // the node type
         using node_type = typename nodal_field_type::input_type;
         // the element type
@@ -62,6 +65,10 @@ namespace mito::fem {
         // accessor to the underlying nodal field (read-only)
         auto nodal_values() const -> const nodal_field_type & { return _nodal_field; }
 
+        // accessor to the underlying nodal field (e.g. to assign the result of an expression of
+        // finite element fields on dense nodal fields)
+        auto nodal_values() -> nodal_field_type & { return _nodal_field; }
+
         // localize the field on {element}
         auto localize(const element_type & element) const -> auto
         {
@@ -40,6 +40,9 @@ namespace mito::fem {
         // a finite element field type
         template <class fieldValueT>
         using fem_field_type = fem_field_t<fieldValueT, function_space_type>;
+        // a finite element field type with the nodal values stored contiguously
+        template <class fieldValueT>
+        using dense_fem_field_type = dense_fem_field_t<fieldValueT, function_space_type>;
 
       public:
         // the constructor
@@ -59,6 +62,62 @@ namespace mito::fem {
                 manifold, constraints, _elements, _node_map, _constrained_nodes);
         }
 
+        // constructor from the numbers {element_nodes} of the discretization nodes of each element
+        // (in the order of iteration on the elements) and the numbers {constrained} of the
+        // constrained nodes, e.g. as restored from a checkpoint: the discretization nodes are
+        // instantiated in bulk, with no need to discretize the manifold
+        template <manifolds::manifold_c manifoldT>
+        // require compatibility between the manifold cell and the finite element cell
+        requires(std::is_same_v<
+                    typename manifoldT::mesh_type::cell_type, typename element_type::cell_type>)
+        FunctionSpace(
+            const manifoldT & manifold, const constraints_type & constraints,
+            std::span<const int> element_nodes, std::span<const int> constrained) :
+            _elements(manifold.nElements()),
+            _constraints(constraints),
+            _node_map()
+        {
+            // the number of nodes per element
+            constexpr int n_nodes = element_type::n_nodes;
+
+            // check that there are as many elements as cells
+            if (std::ssize(element_nodes) != n_nodes * manifold.nElements()) {
+                throw std::runtime_error("function space: Wrong number of element nodes");
+            }
+
+            // instantiate the discretization nodes
+            int n_discretization_nodes =
+                element_nodes.empty() ?
+                    0 :
+                    *std::max_element(std::begin(element_nodes), std::end(element_nodes)) + 1;
+            std::vector<discretization_node_type> nodes(n_discretization_nodes);
+
+            // loop on the cells of the manifold
+            int e = 0;
+            for (const auto & cell : manifold.elements()) {
+                // the discretization nodes of the element
+                auto connectivity = [&]<int... a>(tensor::integer_sequence<a...>) {
+                    return typename element_type::connectivity_type{
+                        nodes[element_nodes[n_nodes * e + a]]...
+                    };
+                }(tensor::make_integer_sequence<n_nodes>{});
+
+                // map the vertices of the cell to the first discretization nodes of the element
+                for (int a = 0; a < std::ssize(cell.nodes()); ++a) {
+                    _node_map.insert({ cell.nodes()[a], connectivity[a] });
+                }
+
+                // create the finite element
+                _elements.emplace(cell, manifold.coordinate_system(), connectivity);
+                ++e;
+            }
+
+            // the constrained nodes
+            for (auto node : constrained) {
+                _constrained_nodes.insert(nodes[node]);
+            }
+        }
+
         // destructor
         constexpr ~FunctionSpace() = default;
 
@@ -110,6 +169,38 @@ namespace mito::fem {
                 discrete::nodal_field_t<fieldValueT>(nodes, name));
         }
 
+        // hand out an preallocated fem field for all the discretization nodes with name {name},
+        // with the nodal values stored contiguously in the order given by
+        // {number_discretization_nodes}
+        template <class fieldValueT>
+        auto dense_fem_field(std::string name) const -> dense_fem_field_type<fieldValueT>
+        {
+            // number the discretization nodes
+            auto nodes = number_discretization_nodes(*this).first;
+
+            // build a dense nodal field on the discretization nodes
+            return dense_fem_field_t<fieldValueT, function_space_type>(
+                discrete::dense_field<fieldValueT>(discrete::dense_index(nodes), name));
+        }
+
+        // hand out a preallocated quadrature field with {Q} values of type {fieldValueT} per
+        // element (e.g. the state of a material at the quadrature points) with name {name}, with
+        // the elements numbered in the order of iteration on the elements
+        template <class fieldValueT, int Q>
+        auto dense_quadrature_field(std::string name) const
+        {
+            // collect the cells of the elements
+            std::vector<typename element_type::cell_type::simplex_type> cells;
+            cells.reserve(std::size(_elements));
+            for (const auto & element : _elements) {
+                cells.push_back(element.cell().simplex());
+            }
+
+            // build a dense quadrature field on the cells
+            return discrete::dense_quadrature_field<fieldValueT, Q>(
+                discrete::dense_index(cells), name);
+        }
+
       private:
         // a collection of finite elements
         elements_type _elements;
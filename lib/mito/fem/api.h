@@ -13,6 +13,11 @@ namespace mito::fem {
     template <class fieldValueT, class functionSpaceT>
     using fem_field_t = FemField<fieldValueT, functionSpaceT>;
 
+    // finite element field alias with the nodal values stored contiguously
+    template <class fieldValueT, class functionSpaceT>
+    using dense_fem_field_t =
+        FemField<fieldValueT, functionSpaceT, discrete::dense_nodal_field_t<fieldValueT>>;
+
     // the possible discretization types: continuous Galerking (CG) vs. discontinuous Galerkin (DG)
     enum class discretization_t { CG, DG };
 
@@ -16,6 +16,14 @@ namespace mito::fem {
         using reference_element_type = geometry::reference_triangle_t;
         // the number of shape functions
         static constexpr int N = 3;
+        // the type of parametric coordinates
+        using parametric_coordinates_type = reference_element_type::parametric_coordinates_type;
+        // the parametric coordinates of the discretization nodes (the vertices)
+        static constexpr std::array<parametric_coordinates_type, N> nodes = {
+            parametric_coordinates_type({ 1.0, 0.0 }),
+            parametric_coordinates_type({ 0.0, 1.0 }),
+            parametric_coordinates_type({ 0.0, 0.0 }),
+        };
 
       private:
         // linear shape functions on the reference triangle in parametric coordinates
@@ -16,6 +16,18 @@ namespace mito::fem {
         using reference_element_type = geometry::reference_triangle_t;
         // the number of shape functions
         static constexpr int N = 6;
+        // the type of parametric coordinates
+        using parametric_coordinates_type = reference_element_type::parametric_coordinates_type;
+        // the parametric coordinates of the discretization nodes (the vertices and the midpoints
+        // of the edges)
+        static constexpr std::array<parametric_coordinates_type, N> nodes = {
+            parametric_coordinates_type({ 1.0, 0.0 }),
+            parametric_coordinates_type({ 0.0, 1.0 }),
+            parametric_coordinates_type({ 0.0, 0.0 }),
+            parametric_coordinates_type({ 0.5, 0.5 }),
+            parametric_coordinates_type({ 0.0, 0.5 }),
+            parametric_coordinates_type({ 0.5, 0.0 }),
+        };
 
       private:
         // get the parametric coordinates from the reference element
@@ -8,7 +8,15 @@
 
 
 // externals
+#include <algorithm>
+#include <type_traits>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 // support
 #include "../journal.h"
@@ -34,8 +34,10 @@ namespace mito::fem {
     template <fields::field_c F>
     class DomainField;
 
-    // class finite element field
-    template <class fieldValueT, class functionSpaceT>
+    // class finite element field (with the nodal values stored in a {nodalFieldT})
+    template <
+        class fieldValueT, class functionSpaceT,
+        class nodalFieldT = discrete::nodal_field_t<fieldValueT>>
     class FemField;
 
     // concept of a localizable field
@@ -48,7 +50,8 @@ namespace mito::fem {
     template <class F>
     concept fem_field_c = requires(F c) {
         // require that F only binds to {FemField} specializations
-        []<class fieldValueT, class functionSpaceT>(const FemField<fieldValueT, functionSpaceT> &) {
+        []<class fieldValueT, class functionSpaceT, class nodalFieldT>(
+            const FemField<fieldValueT, functionSpaceT, nodalFieldT> &) {
         }(c);
     };
 }
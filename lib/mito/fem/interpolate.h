@@ -0,0 +1,73 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::fem {
+
+    // interpolate the continuous {field} on the finite element field {fem_field} of
+    // {function_space}, by evaluating {field} in parallel at all the discretization nodes of the
+    // elements (e.g. also at the edge nodes of second order elements), with coordinates in
+    // {coord_system}
+    // The position of each discretization node is obtained by mapping the parametric coordinates of
+    // the node through the parametrization of (the first) element it belongs to
+    template <fields::field_c fieldT, function_space_c functionSpaceT, fem_field_c femFieldT>
+    auto interpolate(
+        const functionSpaceT & function_space,
+        const geometry::coordinate_system_c auto & coord_system, const fieldT & field,
+        femFieldT & fem_field) -> void
+    {
+        // the finite element type
+        using element_type = typename functionSpaceT::element_type;
+        // the discretization node type
+        using node_type = typename functionSpaceT::discretization_node_type;
+        // the type of the coordinates of the discretization nodes
+        using coordinates_type = typename fieldT::input_type;
+        // the type of the nodal values
+        using value_type = std::decay_t<decltype(fem_field(std::declval<const node_type &>()))>;
+
+        // the number of discretization nodes per element
+        constexpr int n_nodes = element_type::n_nodes;
+        // the parametric coordinates of the discretization nodes of an element
+        constexpr auto nodes = element_type::shape_functions_type::nodes;
+
+        // collect the coordinates of the discretization nodes and their nodal values (visiting
+        // each node once, and without copying the shared pointers to the nodes)
+        std::vector<coordinates_type> coordinates;
+        std::vector<value_type *> values;
+        std::unordered_set<utilities::index_t<node_type>> visited;
+        for (const auto & element : function_space.elements()) {
+            // the discretization nodes of the element
+            const auto & connectivity = element.connectivity();
+            // the mapping from parametric to physical coordinates on the element
+            auto parametrization = element.parametrization();
+
+            for (int a = 0; a < n_nodes; ++a) {
+                // skip the nodes already visited from another element
+                if (!visited.insert(connectivity[a].id()).second) {
+                    continue;
+                }
+
+                // the position of the node and its nodal value
+                coordinates.push_back(coord_system.origin() + parametrization(nodes[a]));
+                values.push_back(&fem_field(connectivity[a]));
+            }
+        }
+
+        // evaluate {field} at the discretization nodes
+        discrete::evaluate(
+            field, std::size(coordinates),
+            [&coordinates](int i) -> const coordinates_type & { return coordinates[i]; },
+            [&values](int i) -> value_type & { return *values[i]; });
+
+        // all done
+        return;
+    }
+}
+
+
+// end of file
@@ -40,4 +40,7 @@
 // norms implementation
 #include "norms.h"
 
+// interpolation implementation
+#include "interpolate.h"
+
 // end of file
@@ -24,6 +24,43 @@ namespace mito::fem {
         return;
     }
 
+    // number the discretization nodes of a function space 0, ..., n - 1 in order of first
+    // appearance while iterating on the elements, and return the nodes in the order of their
+    // numbers together with the numbers of the nodes of each element
+    template <function_space_c functionSpaceT>
+    inline auto number_discretization_nodes(const functionSpaceT & function_space) -> std::pair<
+        std::vector<typename functionSpaceT::discretization_node_type>, std::vector<int>>
+    {
+        // the discretization node type
+        using node_type = typename functionSpaceT::discretization_node_type;
+
+        // the number of nodes per element
+        constexpr int n_nodes = functionSpaceT::element_type::n_nodes;
+
+        // the nodes in the order of their numbers, and the numbers of the nodes of each element
+        std::vector<node_type> nodes;
+        std::vector<int> element_nodes;
+        element_nodes.reserve(n_nodes * std::size(function_space.elements()));
+
+        // the number of each node, by id
+        std::unordered_map<utilities::index_t<node_type>, int> numbers;
+
+        // loop on the elements
+        for (const auto & element : function_space.elements()) {
+            for (const auto & node : element.connectivity()) {
+                // number the node at its first appearance
+                auto [entry, inserted] = numbers.insert({ node.id(), std::size(nodes) });
+                if (inserted) {
+                    nodes.push_back(node);
+                }
+                element_nodes.push_back(entry->second);
+            }
+        }
+
+        // all done
+        return { std::move(nodes), std::move(element_nodes) };
+    }
+
 }
 
 
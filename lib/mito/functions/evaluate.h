@@ -0,0 +1,105 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+// Batched evaluation of functions
+// Each node of an expression of functions evaluates its operands on the whole batch of points
+// first, and then combines their values in a tight loop on the batch (which the compiler can
+// vectorize), instead of walking the expression tree once per point. Nodes that preserve the type
+// of their operand transform its values in place, while the others keep the values of their
+// operands in scratch buffers, so that no memory is allocated per batch. Functions that do not
+// implement a batched evaluation (e.g. the functions of the library) are evaluated point by point
+// in a loop on the batch.
+
+
+namespace mito::functions {
+
+    // evaluate {f} at the batch of points {x}, writing the values to {y}
+    template <function_c F>
+    constexpr auto evaluate(
+        const F & f, std::span<const typename F::input_type> x,
+        std::span<typename F::output_type> y) -> void
+    {
+        // check that there is a value per point
+        assert(std::size(x) == std::size(y));
+
+        if constexpr (requires { f.evaluate(x, y); }) {
+            // let the function evaluate the batch
+            f.evaluate(x, y);
+        } else {
+            // evaluate the function point by point
+            for (std::size_t i = 0; i < std::size(x); ++i) {
+                y[i] = f(x[i]);
+            }
+        }
+
+        // all done
+        return;
+    }
+
+    // evaluate {f} at the batch of points {x}, returning the values
+    template <function_c F>
+    constexpr auto evaluate(const F & f, std::span<const typename F::input_type> x)
+        -> std::vector<typename F::output_type>
+    {
+        // the values of {f} at the points
+        std::vector<typename F::output_type> y(std::size(x));
+
+        // evaluate {f} on the batch
+        evaluate(f, x, std::span(y));
+
+        // all done
+        return y;
+    }
+
+    // a scratch buffer of {n} values of type {T} for the batched evaluation of the expression node
+    // {nodeT} (the {I}-th buffer, if the node needs more than one)
+    // The buffer is private to the calling thread and is reused by all the batches it evaluates;
+    // since a node is never nested within a node of its own type, a buffer is never in use twice
+    template <class nodeT, class T, int I = 0>
+    auto scratch(std::size_t n) -> std::span<T>
+    {
+        // the buffer of the node on the calling thread
+        thread_local std::vector<T> buffer;
+
+        // make room for {n} values
+        if (std::size(buffer) < n) {
+            buffer.resize(n);
+        }
+
+        // all done
+        return std::span<T>(std::data(buffer), n);
+    }
+
+    // evaluate the operand {f} of the expression node {nodeT} on the batch {x}, and return its
+    // values
+    // The values are written straight to the output {y} of the node, if they have the same type, so
+    // that the node can transform them in place, or to a scratch buffer of the node otherwise
+    template <class nodeT, function_c F, class Y>
+    auto operand(const F & f, std::span<const typename F::input_type> x, std::span<Y> y)
+        -> std::span<typename F::output_type>
+    {
+        if constexpr (std::is_same_v<typename F::output_type, Y>) {
+            // evaluate {f} in the output of the node
+            evaluate(f, x, y);
+
+            // all done
+            return y;
+        } else {
+            // evaluate {f} in the scratch buffer of the node
+            auto values = scratch<nodeT, typename F::output_type>(std::size(x));
+            evaluate(f, x, values);
+
+            // all done
+            return values;
+        }
+    }
+}
+
+
+// end of file
@@ -8,6 +8,13 @@
 
 
 // external
+#include <algorithm>
+#include <cassert>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 // support
 #include "../journal.h"
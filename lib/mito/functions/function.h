@@ -60,6 +60,15 @@ namespace mito::functions {
         // call operator
         constexpr auto operator()(const input_type & x) const -> output_type { return _f(x); }
 
+        // batched evaluation
+        constexpr auto evaluate(std::span<const input_type> x, std::span<output_type> y) const
+            -> void
+        {
+            for (std::size_t i = 0; i < std::size(y); ++i) {
+                y[i] = _f(x[i]);
+            }
+        }
+
       private:
         // the functor
         const F _f;
@@ -108,6 +117,12 @@ namespace mito::functions {
         // call operator
         constexpr auto operator()(const input_type &) const -> output_type { return _c; }
 
+        // batched evaluation
+        constexpr auto evaluate(std::span<const input_type>, std::span<output_type> y) const -> void
+        {
+            std::fill(std::begin(y), std::end(y), _c);
+        }
+
       private:
         // the constant
         const output_type _c;
@@ -161,9 +176,50 @@ namespace mito::functions {
             return std::apply([&](const auto &... funcs) { return (funcs(x) + ...); }, _funcs);
         }
 
+        // batched evaluation
+        constexpr auto evaluate(std::span<const input_type> x, std::span<output_type> y) const
+            -> void
+        {
+            // evaluate the functions one at a time on the batch, adding up their values in {y}
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                (_add<Is>(x, y), ...);
+            }(std::make_index_sequence<sizeof...(Funcs)>{});
+        }
+
         // accessor for the functions in the summation
         constexpr auto functions() const -> const functions_type & { return _funcs; }
 
+      private:
+        // evaluate the {K}-th function on the batch {x} and add its values to {y}
+        template <std::size_t K>
+        constexpr auto _add(std::span<const input_type> x, std::span<output_type> y) const -> void
+        {
+            // the {K}-th function and the type of its values
+            const auto & f = std::get<K>(_funcs);
+            using value_type = std::tuple_element_t<K, functions_type>::output_type;
+
+            // the first function writes its values straight to {y}, if it can
+            if constexpr (K == 0 && std::is_same_v<value_type, output_type>) {
+                functions::evaluate(f, x, y);
+            } else {
+                // evaluate the function in the scratch buffer of this node
+                auto values = functions::scratch<Summation, value_type, K>(std::size(x));
+                functions::evaluate(f, x, values);
+
+                // add its values to the running sum
+                for (std::size_t i = 0; i < std::size(y); ++i) {
+                    if constexpr (K == 0) {
+                        y[i] = values[i];
+                    } else {
+                        y[i] = y[i] + values[i];
+                    }
+                }
+            }
+
+            // all done
+            return;
+        }
+
       private:
         // the functions in the summation
         functions_type _funcs;
@@ -228,6 +284,16 @@ namespace mito::functions {
             return eval(x, std::make_index_sequence<N>{});
         }
 
+        // batched evaluation
+        constexpr auto evaluate(std::span<const input_type> x, std::span<output_type> y) const
+            -> void
+        {
+            // evaluate the functions one at a time on the batch, combining their values in {y}
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                (_add<Is>(x, y), ...);
+            }(std::make_index_sequence<N>{});
+        }
+
       public:
         // accessor for the coefficients
         constexpr auto coefficients() const -> const coefficients_type & { return _coeffs; }
@@ -235,6 +301,42 @@ namespace mito::functions {
         // accessor for the functions
         constexpr auto functions() const -> const functions_type & { return _funcs; }
 
+      private:
+        // evaluate the {K}-th function on the batch {x} and add its values, scaled by the {K}-th
+        // coefficient, to {y}
+        template <std::size_t K>
+        constexpr auto _add(std::span<const input_type> x, std::span<output_type> y) const -> void
+        {
+            // the {K}-th function and the type of its values
+            const auto & f = std::get<K>(_funcs);
+            using value_type = std::tuple_element_t<K, functions_type>::output_type;
+
+            // the first function writes its values straight to {y} and scales them in place, if
+            // it can
+            if constexpr (K == 0 && std::is_same_v<value_type, output_type>) {
+                functions::evaluate(f, x, y);
+                for (std::size_t i = 0; i < std::size(y); ++i) {
+                    y[i] = _coeffs[K] * y[i];
+                }
+            } else {
+                // evaluate the function in the scratch buffer of this node
+                auto values = functions::scratch<LinearCombination, value_type, K>(std::size(x));
+                functions::evaluate(f, x, values);
+
+                // add its scaled values to the running combination
+                for (std::size_t i = 0; i < std::size(y); ++i) {
+                    if constexpr (K == 0) {
+                        y[i] = _coeffs[K] * values[i];
+                    } else {
+                        y[i] = y[i] + _coeffs[K] * values[i];
+                    }
+                }
+            }
+
+            // all done
+            return;
+        }
+
       private:
         // the coefficients in the linear combination
         coefficients_type _coeffs;
@@ -285,6 +387,19 @@ namespace mito::functions {
         // call operator
         constexpr auto operator()(const input_type & x) const -> output_type { return _f(x) + _a; }
 
+        // batched evaluation
+        constexpr auto evaluate(std::span<const input_type> x, std::span<output_type> y) const
+            -> void
+        {
+            // evaluate the function on the batch
+            auto values = functions::operand<FunctionPlusConstant>(_f, x, y);
+
+            // combine the values
+            for (std::size_t i = 0; i < std::size(y); ++i) {
+                y[i] = values[i] + _a;
+            }
+        }
+
         // the base function
         constexpr auto f() const -> const F & { return _f; }
 
@@ -338,6 +453,21 @@ namespace mito::functions {
             return _f(x) * _g(x);
         }
 
+        // batched evaluation
+        constexpr auto evaluate(std::span<const input_type> x, std::span<output_type> y) const
+            -> void
+        {
+            // evaluate the functions on the batch
+            auto values_f = functions::operand<Product>(_f, x, y);
+            auto values_g = functions::scratch<Product, typename G::output_type, 1>(std::size(x));
+            functions::evaluate(_g, x, values_g);
+
+            // multiply their values
+            for (std::size_t i = 0; i < std::size(y); ++i) {
+                y[i] = values_f[i] * values_g[i];
+            }
+        }
+
         // the first in the sum
         constexpr auto f1() const -> const F & { return _f; }
 
@@ -394,6 +524,19 @@ namespace mito::functions {
         // call operator
         constexpr auto operator()(const input_type & x) const -> output_type { return _f(x) * _a; }
 
+        // batched evaluation
+        constexpr auto evaluate(std::span<const input_type> x, std::span<output_type> y) const
+            -> void
+        {
+            // evaluate the function on the batch
+            auto values = functions::operand<FunctionTimesConstant>(_f, x, y);
+
+            // combine the values
+            for (std::size_t i = 0; i < std::size(y); ++i) {
+                y[i] = values[i] * _a;
+            }
+        }
+
         // the base function
         constexpr auto f() const -> const F & { return _f; }
 
@@ -449,6 +592,19 @@ namespace mito::functions {
         // call operator
         constexpr auto operator()(const input_type & x) const -> output_type { return _a * _f(x); }
 
+        // batched evaluation
+        constexpr auto evaluate(std::span<const input_type> x, std::span<output_type> y) const
+            -> void
+        {
+            // evaluate the function on the batch
+            auto values = functions::operand<ConstantTimesFunction>(_f, x, y);
+
+            // combine the values
+            for (std::size_t i = 0; i < std::size(y); ++i) {
+                y[i] = _a * values[i];
+            }
+        }
+
         // the base function
         constexpr auto f() const -> const F & { return _f; }
 
@@ -486,6 +642,19 @@ namespace mito::functions {
         // call operator
         constexpr auto operator()(const input_type & x) const -> output_type { return 1.0 / _f(x); }
 
+        // batched evaluation
+        constexpr auto evaluate(std::span<const input_type> x, std::span<output_type> y) const
+            -> void
+        {
+            // evaluate the function on the batch
+            auto values = functions::operand<Reciprocal>(_f, x, y);
+
+            // combine the values
+            for (std::size_t i = 0; i < std::size(y); ++i) {
+                y[i] = 1.0 / values[i];
+            }
+        }
+
         // the base function
         constexpr auto f() const -> const F & { return _f; }
 
@@ -534,6 +703,21 @@ namespace mito::functions {
         // call operator
         constexpr auto operator()(const input_type & x) const -> output_type { return _f(_g(x)); }
 
+        // batched evaluation
+        constexpr auto evaluate(std::span<const input_type> x, std::span<output_type> y) const
+            -> void
+        {
+            // evaluate the inner function on the batch
+            auto values = functions::scratch<Composition, typename G::output_type>(std::size(x));
+            functions::evaluate(_g, x, values);
+
+            // evaluate the outer function on the values of the inner function
+            functions::evaluate(_f, std::span<const typename G::output_type>(values), y);
+
+            // all done
+            return;
+        }
+
         // the outer in the composition
         constexpr auto f1() const -> const F & { return _f; }
 
@@ -573,6 +757,19 @@ namespace mito::functions {
         // call operator
         constexpr auto operator()(const input_type & x) const -> output_type { return _f(x)[_i]; }
 
+        // batched evaluation
+        constexpr auto evaluate(std::span<const input_type> x, std::span<output_type> y) const
+            -> void
+        {
+            // evaluate the function on the batch
+            auto values = functions::operand<Subscript>(_f, x, y);
+
+            // combine the values
+            for (std::size_t i = 0; i < std::size(y); ++i) {
+                y[i] = values[i][_i];
+            }
+        }
+
         // the function to subscript
         constexpr auto f() const -> const F & { return _f; }
 
@@ -629,6 +826,19 @@ namespace mito::functions {
             return tensor::transpose(_f(x));
         }
 
+        // batched evaluation
+        constexpr auto evaluate(std::span<const input_type> x, std::span<output_type> y) const
+            -> void
+        {
+            // evaluate the function on the batch
+            auto values = functions::operand<Transpose>(_f, x, y);
+
+            // combine the values
+            for (std::size_t i = 0; i < std::size(y); ++i) {
+                y[i] = tensor::transpose(values[i]);
+            }
+        }
+
         // the function to transpose
         constexpr auto f() const -> const F & { return _f; }
 
@@ -668,6 +878,19 @@ namespace mito::functions {
             return tensor::determinant(_f(x));
         }
 
+        // batched evaluation
+        constexpr auto evaluate(std::span<const input_type> x, std::span<output_type> y) const
+            -> void
+        {
+            // evaluate the function on the batch
+            auto values = functions::operand<Determinant>(_f, x, y);
+
+            // combine the values
+            for (std::size_t i = 0; i < std::size(y); ++i) {
+                y[i] = tensor::determinant(values[i]);
+            }
+        }
+
         // the matrix function to invert
         constexpr auto f() const -> const F & { return _f; }
 
@@ -719,6 +942,19 @@ namespace mito::functions {
             return tensor::inverse(_f(x));
         }
 
+        // batched evaluation
+        constexpr auto evaluate(std::span<const input_type> x, std::span<output_type> y) const
+            -> void
+        {
+            // evaluate the function on the batch
+            auto values = functions::operand<Inverse>(_f, x, y);
+
+            // combine the values
+            for (std::size_t i = 0; i < std::size(y); ++i) {
+                y[i] = tensor::inverse(values[i]);
+            }
+        }
+
         // the matrix function to invert
         constexpr auto f() const -> const F & { return _f; }
 
@@ -769,6 +1005,22 @@ namespace mito::functions {
             return tensor::dyadic(_f1(x), _f2(x));
         }
 
+        // batched evaluation
+        constexpr auto evaluate(std::span<const input_type> x, std::span<output_type> y) const
+            -> void
+        {
+            // evaluate the functions on the batch
+            auto values_1 = functions::operand<DyadicProduct>(_f1, x, y);
+            auto values_2 =
+                functions::scratch<DyadicProduct, typename F2::output_type, 1>(std::size(x));
+            functions::evaluate(_f2, x, values_2);
+
+            // take the dyadic product of their values
+            for (std::size_t i = 0; i < std::size(y); ++i) {
+                y[i] = tensor::dyadic(values_1[i], values_2[i]);
+            }
+        }
+
         // the first function in the dyadic product
         constexpr auto f1() const -> const F1 & { return _f1; }
 
@@ -16,6 +16,9 @@
 // get the type traits for functions
 #include "traits.h"
 
+// the batched evaluation of functions
+#include "evaluate.h"
+
 // the functions definitions
 #include "function.h"
 // the algebra of functions
@@ -0,0 +1,115 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io {
+
+    // a dedicated thread serializing and writing output in the background, one job at a time in
+    // the order the jobs are submitted
+    // The jobs must be self-contained (i.e. own a snapshot of everything they write), as they may
+    // run after the writer that submitted them is gone
+    class OutputThread {
+
+      public:
+        // constructor
+        OutputThread() : _jobs(), _mutex(), _condition(), _done(false), _thread([this] { _run(); })
+        {}
+
+        // destructor (the pending jobs are completed before the thread is joined)
+        ~OutputThread()
+        {
+            // signal the thread that no more jobs are coming
+            {
+                std::lock_guard lock(_mutex);
+                _done = true;
+            }
+            _condition.notify_one();
+
+            // wait for the thread to run the pending jobs
+            _thread.join();
+        }
+
+      private:
+        // delete copy constructor
+        OutputThread(const OutputThread &) = delete;
+
+        // delete move constructor
+        OutputThread(OutputThread &&) = delete;
+
+        // delete assignment operator
+        OutputThread & operator=(const OutputThread &) = delete;
+
+        // delete move assignment operator
+        OutputThread & operator=(OutputThread &&) = delete;
+
+      private:
+        // run the jobs as they are submitted
+        auto _run() -> void
+        {
+            while (true) {
+                // wait for a job (or for the thread to be done)
+                std::packaged_task<void()> job;
+                {
+                    std::unique_lock lock(_mutex);
+                    _condition.wait(lock, [this] { return _done || !_jobs.empty(); });
+                    // if there is nothing left to do, we are done
+                    if (_jobs.empty()) {
+                        return;
+                    }
+                    job = std::move(_jobs.front());
+                    _jobs.pop_front();
+                }
+
+                // run the job (errors are stored in its future)
+                job();
+            }
+        }
+
+      public:
+        // submit {job} to be run on the output thread, and get a future for its completion
+        auto submit(std::function<void()> job) -> std::shared_future<void>
+        {
+            // wrap the job in a task
+            std::packaged_task<void()> task(std::move(job));
+            auto future = task.get_future().share();
+
+            // queue the task
+            {
+                std::lock_guard lock(_mutex);
+                _jobs.push_back(std::move(task));
+            }
+            _condition.notify_one();
+
+            // all done
+            return future;
+        }
+
+      private:
+        // the queue of pending jobs
+        std::deque<std::packaged_task<void()>> _jobs;
+        // the mutex protecting the queue
+        std::mutex _mutex;
+        // the condition signaling a new job (or the end of the thread)
+        std::condition_variable _condition;
+        // whether the thread should stop once the queue is empty
+        bool _done;
+        // the thread (started last, once the queue is set up)
+        std::thread _thread;
+    };
+
+    // the output thread shared by all writers (started at first use)
+    inline auto output_thread() -> OutputThread &
+    {
+        static OutputThread thread;
+        return thread;
+    }
+
+}    // namespace mito::io
+
+
+// end of file
@@ -12,16 +12,67 @@ namespace mito::io {
     // a class that writes to file
     class Writer {
 
+      private:
+        // the maximum number of writes of this writer pending on the output thread (taking a new
+        // snapshot first waits for the oldest one to be written, so that at most two snapshots are
+        // held at any time)
+        static constexpr int max_pending = 2;
+
       public:
         // constructor
-        Writer(std::string filename) : _filename(filename) {}
+        Writer(std::string filename) : _filename(filename), _pending() {}
 
         // the {write} method
         virtual auto write() const -> void = 0;
 
+        // write in the background: take a snapshot of the output now, and hand its serialization
+        // and writing over to the output thread
+        auto write_async() -> std::shared_future<void>
+        {
+            // if too many writes are pending, wait for the oldest one
+            if (std::ssize(_pending) == max_pending) {
+                auto oldest = std::move(_pending.front());
+                _pending.pop_front();
+                oldest.get();
+            }
+
+            // submit the snapshot to the output thread
+            auto future = output_thread().submit(_snapshot());
+            _pending.push_back(future);
+
+            // all done
+            return future;
+        }
+
+        // wait for the pending writes of this writer (rethrowing their errors, if any)
+        auto wait() -> void
+        {
+            while (!_pending.empty()) {
+                auto oldest = std::move(_pending.front());
+                _pending.pop_front();
+                oldest.get();
+            }
+
+            // all done
+            return;
+        }
+
+      protected:
+        // a self-contained job writing the current output to file (by default, the output is
+        // written right away and nothing is left for the job to do)
+        virtual auto _snapshot() const -> std::function<void()>
+        {
+            write();
+            return [] {};
+        }
+
       protected:
         // the name of the output file to be written
         std::string _filename;
+
+      private:
+        // the writes of this writer pending on the output thread
+        std::deque<std::shared_future<void>> _pending;
     };
 
 }    // namespace mito::io
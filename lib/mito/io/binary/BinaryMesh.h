@@ -0,0 +1,141 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::binary {
+
+    // a zero-copy view of a mesh file in binary format: the file is mapped in memory and its
+    // sections are viewed in place, so opening a mesh costs no parsing and no copies
+    class BinaryMesh {
+
+      public:
+        // constructor from the name of the file
+        inline BinaryMesh(const std::string & filename) : _file(filename), _header()
+        {
+            // check that the file holds a header
+            if (_file.size() < sizeof(header_t)) {
+                throw std::runtime_error("binary: File " + filename + " is too short");
+            }
+
+            // read the header
+            std::memcpy(&_header, _file.data(), sizeof(header_t));
+
+            // check the magic string, the byte order and the version
+            if (_header.magic != header_t().magic) {
+                throw std::runtime_error("binary: File " + filename + " is not a mito mesh");
+            }
+            if (_header.byte_order != header_t().byte_order) {
+                throw std::runtime_error("binary: File " + filename + " has wrong byte order");
+            }
+            if (_header.version != header_t().version) {
+                throw std::runtime_error("binary: File " + filename + " has unknown version");
+            }
+
+            // check that the sizes and the flags in the header are in range
+            if (_header.n_nodes < 0 || _header.n_cells < 0 || _header.dim <= 0
+                || _header.n_vertices <= 0 || (_header.has_tags != 0 && _header.has_tags != 1)
+                || (_header.has_partitions != 0 && _header.has_partitions != 1)) {
+                throw std::runtime_error("binary: File " + filename + " is corrupted");
+            }
+
+            // check that the sections are where they are expected, and within the file
+            auto expected = _header;
+            layout(expected);
+            if (expected.coordinates_offset != _header.coordinates_offset
+                || expected.connectivity_offset != _header.connectivity_offset
+                || expected.tags_offset != _header.tags_offset
+                || expected.partitions_offset != _header.partitions_offset
+                || expected.file_size != _header.file_size
+                || _header.file_size > static_cast<std::int64_t>(_file.size())) {
+                throw std::runtime_error("binary: File " + filename + " is corrupted");
+            }
+        }
+
+        // destructor
+        inline ~BinaryMesh() = default;
+
+        // move constructor
+        inline BinaryMesh(BinaryMesh &&) noexcept = default;
+
+      private:
+        // delete copy constructor
+        BinaryMesh(const BinaryMesh &) = delete;
+
+        // delete assignment operator
+        BinaryMesh & operator=(const BinaryMesh &) = delete;
+
+        // delete move assignment operator
+        BinaryMesh & operator=(BinaryMesh &&) noexcept = delete;
+
+      private:
+        // a view of {size} items of type {T} starting at {offset} bytes in the file
+        template <class T>
+        inline auto _view(std::int64_t offset, std::int64_t size) const -> std::span<const T>
+        {
+            // an absent section
+            if (size == 0) {
+                return {};
+            }
+
+            // the sections are aligned in the file, and the mapping is page-aligned
+            return { reinterpret_cast<const T *>(_file.data() + offset),
+                     static_cast<std::size_t>(size) };
+        }
+
+      public:
+        // the header of the file
+        inline auto header() const noexcept -> const header_t & { return _header; }
+
+        // the dimension of the physical space
+        inline auto dim() const noexcept -> int { return _header.dim; }
+
+        // the number of nodes per cell
+        inline auto n_vertices() const noexcept -> int { return _header.n_vertices; }
+
+        // the number of nodes
+        inline auto n_nodes() const noexcept -> std::int64_t { return _header.n_nodes; }
+
+        // the number of cells
+        inline auto n_cells() const noexcept -> std::int64_t { return _header.n_cells; }
+
+        // the coordinates of the nodes, {dim} per node
+        inline auto coordinates() const -> std::span<const double>
+        {
+            return _view<double>(_header.coordinates_offset, _header.n_nodes * _header.dim);
+        }
+
+        // the 0-based indices of the nodes of the cells, {n_vertices} per cell
+        inline auto connectivity() const -> std::span<const std::int32_t>
+        {
+            return _view<std::int32_t>(
+                _header.connectivity_offset, _header.n_cells * _header.n_vertices);
+        }
+
+        // the tags of the cells (empty, if the file stores no tags)
+        inline auto tags() const -> std::span<const std::int32_t>
+        {
+            return _view<std::int32_t>(_header.tags_offset, _header.has_tags * _header.n_cells);
+        }
+
+        // the partition ids of the cells (empty, if the file stores no partition ids)
+        inline auto partitions() const -> std::span<const std::int32_t>
+        {
+            return _view<std::int32_t>(
+                _header.partitions_offset, _header.has_partitions * _header.n_cells);
+        }
+
+      private:
+        // the mapping of the file
+        MappedFile _file;
+        // a copy of the header
+        header_t _header;
+    };
+}
+
+
+// end of file
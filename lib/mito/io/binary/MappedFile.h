@@ -0,0 +1,93 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::binary {
+
+    // a read-only memory mapping of a file, released on destruction
+    class MappedFile {
+
+      public:
+        // constructor from the name of the file
+        inline MappedFile(const std::string & filename) : _data(nullptr), _size(0)
+        {
+            // open the file
+            int descriptor = ::open(filename.c_str(), O_RDONLY);
+            if (descriptor < 0) {
+                throw std::runtime_error("binary: File " + filename + " could not be opened");
+            }
+
+            // get the size of the file
+            struct stat status;
+            if (::fstat(descriptor, &status) != 0) {
+                ::close(descriptor);
+                throw std::runtime_error("binary: File " + filename + " could not be inspected");
+            }
+            _size = status.st_size;
+
+            // map the file in memory (an empty file cannot be mapped, and has nothing to view)
+            if (_size > 0) {
+                auto data = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+                if (data == MAP_FAILED) {
+                    ::close(descriptor);
+                    throw std::runtime_error("binary: File " + filename + " could not be mapped");
+                }
+                _data = static_cast<const std::byte *>(data);
+
+                // the file is read front to back when building a mesh
+                ::madvise(data, _size, MADV_SEQUENTIAL);
+            }
+
+            // the mapping outlives the file descriptor
+            ::close(descriptor);
+        }
+
+        // destructor
+        inline ~MappedFile()
+        {
+            // unmap the file
+            if (_data != nullptr) {
+                ::munmap(const_cast<std::byte *>(_data), _size);
+            }
+        }
+
+        // move constructor
+        inline MappedFile(MappedFile && other) noexcept : _data(other._data), _size(other._size)
+        {
+            // the mapping now belongs to this object
+            other._data = nullptr;
+            other._size = 0;
+        }
+
+      private:
+        // delete copy constructor
+        MappedFile(const MappedFile &) = delete;
+
+        // delete assignment operator
+        MappedFile & operator=(const MappedFile &) = delete;
+
+        // delete move assignment operator
+        MappedFile & operator=(MappedFile &&) noexcept = delete;
+
+      public:
+        // the contents of the file
+        inline auto data() const noexcept -> const std::byte * { return _data; }
+
+        // the size in bytes of the file
+        inline auto size() const noexcept -> std::size_t { return _size; }
+
+      private:
+        // the address of the mapping
+        const std::byte * _data;
+        // the size of the mapping
+        std::size_t _size;
+    };
+}
+
+
+// end of file
@@ -0,0 +1,17 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::binary {
+
+    // binary mesh file alias
+    using binary_mesh_t = BinaryMesh;
+}
+
+
+// end of file
@@ -0,0 +1,92 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::binary {
+
+    // convert the summit mesh file {summit_filename} to the mesh file {filename}.mito in binary
+    // format, keeping the cell set id of each cell (if numeric) as its tag
+    // The conversion goes straight from file to file, without building the mesh
+    inline auto from_summit(const std::string & summit_filename, std::string filename) -> void
+    {
+        // open the summit file
+        std::ifstream fileStream(summit_filename);
+        if (!fileStream.is_open()) {
+            throw std::runtime_error("reader: Mesh file could not be opened");
+        }
+
+        // make a channel
+        journal::info_t channel("mito.binary.converter");
+
+        // report
+        channel << "Converting summit mesh " << summit_filename << "..." << journal::endl;
+
+        // read the heading
+        int dim = 0;
+        std::int64_t n_nodes = 0;
+        std::int64_t n_cells = 0;
+        int n_cell_types = 0;
+        fileStream >> dim >> n_nodes >> n_cells >> n_cell_types;
+        if (!fileStream || dim < 1 || dim > 3 || n_nodes < 0 || n_cells < 0) {
+            throw std::runtime_error("reader: Mesh file has invalid heading");
+        }
+        if (n_nodes > std::numeric_limits<std::int32_t>::max()) {
+            throw std::runtime_error("binary: Too many nodes for int32 connectivity");
+        }
+
+        // read the coordinates of the nodes
+        std::vector<double> coordinates(dim * n_nodes);
+        for (auto & x : coordinates) {
+            fileStream >> x;
+        }
+
+        // read the cells
+        int cell_type = 0;
+        std::vector<std::int32_t> connectivity;
+        std::vector<std::int32_t> tags(n_cells, 0);
+        std::string line;
+        for (std::int64_t e = 0; e < n_cells; ++e) {
+            // read the cell type (which is also the number of nodes of a summit simplex)
+            int type = 0;
+            fileStream >> type;
+            if (e == 0) {
+                cell_type = type;
+                connectivity.reserve(n_cells * cell_type);
+            } else if (type != cell_type) {
+                throw std::runtime_error("binary: Meshes with mixed cell types are not supported");
+            }
+
+            // read the node ids (the summit format starts counting from one)
+            for (int a = 0; a < cell_type; ++a) {
+                std::int32_t id = 0;
+                fileStream >> id;
+                connectivity.push_back(id - 1);
+            }
+
+            // read the cell set id from the rest of the line
+            std::getline(fileStream, line);
+            std::istringstream rest(line);
+            std::string cell_set_id;
+            rest >> cell_set_id;
+            std::from_chars(
+                cell_set_id.data(), cell_set_id.data() + std::size(cell_set_id), tags[e]);
+        }
+        if (!fileStream) {
+            throw std::runtime_error("reader: Mesh file ended unexpectedly");
+        }
+
+        // write the binary file
+        write(filename + ".mito", dim, cell_type, cell_type, coordinates, connectivity, tags);
+
+        // all done
+        return;
+    }
+}
+
+
+// end of file
@@ -0,0 +1,20 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::binary {
+
+    // class for a read-only memory mapping of a file
+    class MappedFile;
+
+    // class for a zero-copy view of a mesh file in binary format
+    class BinaryMesh;
+}
+
+
+// end of file
@@ -0,0 +1,171 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::binary {
+
+    // the header of a mesh file in binary format
+    // The file stores, after the header and in native byte order, the coordinates of the nodes
+    // ({dim} doubles per node), the connectivity of the cells ({n_vertices} 0-based int32 node
+    // indices per cell) and, optionally, an int32 tag and an int32 partition id per cell. Each
+    // section starts at the offset recorded in the header, aligned to {alignment} bytes, so that
+    // it can be viewed in place once the file is mapped in memory
+    struct header_t {
+        // the magic string identifying the format
+        std::array<char, 8> magic = { 'M', 'I', 'T', 'O', 'M', 'S', 'H', '\0' };
+        // the byte order mark (reads differently on a machine with the other endianness)
+        std::uint32_t byte_order = 0x01020304;
+        // the version of the format
+        std::int32_t version = 1;
+        // the dimension of the physical space
+        std::int32_t dim = 0;
+        // the summit type of the cells
+        std::int32_t cell_type = 0;
+        // the number of nodes per cell
+        std::int32_t n_vertices = 0;
+        // whether the file stores the cell tags and the partition ids
+        std::int32_t has_tags = 0;
+        std::int32_t has_partitions = 0;
+        // padding
+        std::int32_t reserved = 0;
+        // the number of nodes and of cells
+        std::int64_t n_nodes = 0;
+        std::int64_t n_cells = 0;
+        // the offsets in bytes of the sections from the beginning of the file
+        std::int64_t coordinates_offset = 0;
+        std::int64_t connectivity_offset = 0;
+        std::int64_t tags_offset = 0;
+        std::int64_t partitions_offset = 0;
+        // the size in bytes of the file
+        std::int64_t file_size = 0;
+    };
+
+    // the alignment in bytes of the sections of the file
+    constexpr std::int64_t alignment = 64;
+
+    // round {offset} up to the next multiple of {alignment}
+    constexpr auto align(std::int64_t offset) -> std::int64_t
+    {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+    // fill in the offsets of the sections of the file described by {header}
+    constexpr auto layout(header_t & header) -> void
+    {
+        // the coordinates follow the header
+        header.coordinates_offset = align(sizeof(header_t));
+        // then the connectivity
+        header.connectivity_offset = align(
+            header.coordinates_offset
+            + header.n_nodes * header.dim * static_cast<std::int64_t>(sizeof(double)));
+        // then the tags and the partition ids, if present
+        auto end = header.connectivity_offset
+                 + header.n_cells * header.n_vertices
+                       * static_cast<std::int64_t>(sizeof(std::int32_t));
+        header.tags_offset = header.has_tags ? align(end) : 0;
+        if (header.has_tags) {
+            end = header.tags_offset
+                + header.n_cells * static_cast<std::int64_t>(sizeof(std::int32_t));
+        }
+        header.partitions_offset = header.has_partitions ? align(end) : 0;
+        if (header.has_partitions) {
+            end = header.partitions_offset
+                + header.n_cells * static_cast<std::int64_t>(sizeof(std::int32_t));
+        }
+        header.file_size = end;
+
+        // all done
+        return;
+    }
+
+    // the header of a partitioned mesh file in binary format
+    // The file stores, after the header, an index with one entry per part and then, for each part,
+    // a chunk with the cells the part owns followed by its ghost cells, in the form of a partition
+    // of a distributed mesh: the global ids and the owners of the cells, the local numbers of their
+    // nodes, and the global ids, owners, global numbers and coordinates of the nodes. Each task
+    // reads its own index entry and chunk, and nothing else
+    struct partitioned_header_t {
+        // the magic string identifying the format
+        std::array<char, 8> magic = { 'M', 'I', 'T', 'O', 'P', 'R', 'T', '\0' };
+        // the byte order mark (reads differently on a machine with the other endianness)
+        std::uint32_t byte_order = 0x01020304;
+        // the version of the format
+        std::int32_t version = 1;
+        // the dimension of the physical space
+        std::int32_t dim = 0;
+        // the summit type of the cells
+        std::int32_t cell_type = 0;
+        // the number of nodes per cell
+        std::int32_t n_vertices = 0;
+        // the number of parts
+        std::int32_t n_parts = 0;
+        // the number of layers of ghost cells
+        std::int32_t n_layers = 0;
+        // padding
+        std::int32_t reserved = 0;
+        // the total number of nodes and of cells
+        std::int64_t n_nodes = 0;
+        std::int64_t n_cells = 0;
+        // the offset in bytes of the index from the beginning of the file
+        std::int64_t index_offset = 0;
+        // the size in bytes of the file
+        std::int64_t file_size = 0;
+    };
+
+    // the entry of a part in the index of a partitioned mesh file
+    struct part_t {
+        // the number of cells owned by the part
+        std::int64_t n_owned_cells = 0;
+        // the number of cells of the part (owned and ghost)
+        std::int64_t n_cells = 0;
+        // the number of nodes of the part
+        std::int64_t n_nodes = 0;
+        // the offsets in bytes of the sections of the chunk of the part
+        std::int64_t cells_offset = 0;
+        std::int64_t cell_owners_offset = 0;
+        std::int64_t connectivity_offset = 0;
+        std::int64_t node_ids_offset = 0;
+        std::int64_t node_owners_offset = 0;
+        std::int64_t node_numbers_offset = 0;
+        std::int64_t coordinates_offset = 0;
+        // the offset in bytes of the end of the chunk
+        std::int64_t end = 0;
+    };
+
+    // fill in the offsets of the sections of the chunk of {part}, starting at {offset}, for cells
+    // with {n_vertices} nodes in a space of dimension {dim}
+    constexpr auto layout(part_t & part, std::int64_t offset, int dim, int n_vertices) -> void
+    {
+        // the sizes of the items of the sections
+        constexpr auto id_size = static_cast<std::int64_t>(sizeof(std::int64_t));
+        constexpr auto int_size = static_cast<std::int64_t>(sizeof(std::int32_t));
+        constexpr auto double_size = static_cast<std::int64_t>(sizeof(double));
+
+        // the sections of the cells, then the sections of the nodes
+        part.cells_offset = align(offset);
+        part.cell_owners_offset = align(part.cells_offset + part.n_cells * id_size);
+        part.connectivity_offset = align(part.cell_owners_offset + part.n_cells * int_size);
+        part.node_ids_offset =
+            align(part.connectivity_offset + part.n_cells * n_vertices * int_size);
+        part.node_owners_offset = align(part.node_ids_offset + part.n_nodes * id_size);
+        part.node_numbers_offset = align(part.node_owners_offset + part.n_nodes * int_size);
+        part.coordinates_offset = align(part.node_numbers_offset + part.n_nodes * id_size);
+        part.end = part.coordinates_offset + part.n_nodes * dim * double_size;
+
+        // all done
+        return;
+    }
+
+    // the headers and the index entries must be copied to and from the file verbatim
+    static_assert(std::is_trivially_copyable_v<header_t>);
+    static_assert(std::is_trivially_copyable_v<partitioned_header_t>);
+    static_assert(std::is_trivially_copyable_v<part_t>);
+}
+
+
+// end of file
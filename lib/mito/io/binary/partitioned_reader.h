@@ -0,0 +1,189 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::binary {
+
+    // read from the partitioned mesh file {filename} (see {partitioned_writer}) the partition of
+    // this task, with one part per task in {communicator}
+    // Each task reads with independent MPI-IO reads only the header, its own index entry and its
+    // own chunk, which already hold the owners and global numbers of its nodes and its ghost
+    // cells, so that neither the I/O volume nor the memory of a task grow with the number of tasks
+    template <class cellT, geometry::coordinates_c coordT>
+    requires(utilities::same_dim_c<cellT, coordT>)
+    auto partitioned_reader(
+        const std::string & filename, geometry::coordinate_system_t<coordT> & coordinate_system,
+        MPI_Comm communicator = MPI_COMM_WORLD) -> mesh::distributed::partition_t<cellT>
+    {
+        // the dimension of the physical space
+        constexpr int D = cellT::dim;
+        // the number of nodes per cell
+        constexpr int V = cellT::n_vertices;
+
+        // the id of this task and the number of tasks
+        int task_id = 0;
+        int n_tasks = 0;
+        MPI_Comm_rank(communicator, &task_id);
+        MPI_Comm_size(communicator, &n_tasks);
+
+        // make a channel
+        journal::info_t channel("mito.binary.partitioned_reader");
+
+        // report
+        channel << "Loading partitioned mesh..." << journal::endl;
+
+        // open the file (collectively)
+        MPI_File file;
+        if (MPI_File_open(communicator, filename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &file)
+            != MPI_SUCCESS) {
+            throw std::runtime_error("binary: File " + filename + " could not be opened");
+        }
+
+        // the first error met by this task, if any (the tasks agree on the errors before closing
+        // the file, which is collective, so that no task is left waiting for the others)
+        std::string error;
+
+        // helper function to record the error {message}, unless {condition} holds
+        auto _check = [&error](bool condition, const std::string & message) {
+            if (error.empty() && !condition) {
+                error = message;
+            }
+        };
+
+        // helper function to read {size} bytes at {offset} into {data} (in pieces addressable by
+        // an int count)
+        auto _read = [&file, &error, &_check](std::int64_t offset, void * data, std::int64_t size) {
+            constexpr std::int64_t piece = std::int64_t(1) << 30;
+            auto bytes = static_cast<char *>(data);
+            for (std::int64_t done = 0; error.empty() && done < size; done += piece) {
+                int count = std::min(piece, size - done);
+                MPI_Status status;
+                int n_read = 0;
+                _check(
+                    MPI_File_read_at(file, offset + done, bytes + done, count, MPI_BYTE, &status)
+                            == MPI_SUCCESS
+                        && MPI_Get_count(&status, MPI_BYTE, &n_read) == MPI_SUCCESS
+                        && n_read == count,
+                    "could not be read");
+            }
+        };
+
+        // helper function to read the section of {n} items at {offset} into {values}
+        auto _section = [&error, &_read](std::int64_t offset, std::int64_t n, auto & values) {
+            if (error.empty()) {
+                values.resize(n);
+                _read(offset, values.data(), n * sizeof(values[0]));
+            }
+        };
+
+        // the size of the file
+        MPI_Offset file_size = 0;
+        _check(MPI_File_get_size(file, &file_size) == MPI_SUCCESS, "could not be read");
+
+        // read and check the header
+        partitioned_header_t header;
+        _read(0, &header, sizeof(header));
+        _check(header.magic == partitioned_header_t().magic, "is not a partitioned mito mesh");
+        _check(header.byte_order == partitioned_header_t().byte_order, "has wrong byte order");
+        _check(header.version == partitioned_header_t().version, "has unknown version");
+        _check(
+            header.dim == D && header.n_vertices == V
+                && header.cell_type == summit::cell<cellT>::type,
+            "holds cells of a different type");
+        _check(
+            header.n_parts == n_tasks,
+            "has " + std::to_string(header.n_parts) + " parts for " + std::to_string(n_tasks)
+                + " tasks");
+        _check(
+            header.file_size == file_size && header.index_offset >= std::int64_t(sizeof(header))
+                && header.index_offset <= file_size
+                && header.n_parts
+                       <= (file_size - header.index_offset) / std::int64_t(sizeof(part_t)),
+            "is corrupted");
+
+        // read the index entry of this task
+        part_t part;
+        _read(header.index_offset + task_id * std::int64_t(sizeof(part_t)), &part, sizeof(part));
+
+        // check that the chunk of this task is laid out as expected, and within the file (every
+        // cell and every node takes at least the 8 bytes of its global id, which bounds the sizes
+        // of the sections before they are computed)
+        _check(
+            part.n_owned_cells >= 0 && part.n_owned_cells <= part.n_cells
+                && part.n_cells <= header.n_cells && part.n_cells <= file_size / 8
+                && part.n_nodes >= 0 && part.n_nodes <= header.n_nodes
+                && part.n_nodes <= file_size / 8 && part.cells_offset >= header.index_offset,
+            "is corrupted");
+        if (error.empty()) {
+            auto expected = part;
+            layout(expected, part.cells_offset, D, V);
+            _check(
+                expected.cells_offset == part.cells_offset
+                    && expected.cell_owners_offset == part.cell_owners_offset
+                    && expected.connectivity_offset == part.connectivity_offset
+                    && expected.node_ids_offset == part.node_ids_offset
+                    && expected.node_owners_offset == part.node_owners_offset
+                    && expected.node_numbers_offset == part.node_numbers_offset
+                    && expected.coordinates_offset == part.coordinates_offset
+                    && expected.end == part.end && part.end <= header.file_size,
+                "is corrupted");
+        }
+
+        // read the chunk of this task
+        std::vector<std::int64_t> cells;
+        std::vector<std::int32_t> cell_owners;
+        std::vector<std::int32_t> connectivity;
+        std::vector<std::int64_t> node_ids;
+        std::vector<std::int32_t> node_owners;
+        std::vector<std::int64_t> node_numbers;
+        std::vector<double> coordinates;
+        _section(part.cells_offset, part.n_cells, cells);
+        _section(part.cell_owners_offset, part.n_cells, cell_owners);
+        _section(part.connectivity_offset, V * part.n_cells, connectivity);
+        _section(part.node_ids_offset, part.n_nodes, node_ids);
+        _section(part.node_owners_offset, part.n_nodes, node_owners);
+        _section(part.node_numbers_offset, part.n_nodes, node_numbers);
+        _section(part.coordinates_offset, D * part.n_nodes, coordinates);
+
+        // agree on whether any task failed, then close the file (collectively)
+        int failed = !error.empty();
+        int any_failed = 0;
+        MPI_Allreduce(&failed, &any_failed, 1, MPI_INT, MPI_MAX, communicator);
+        MPI_File_close(&file);
+
+        // report the error of this task, or that of another task
+        if (any_failed) {
+            throw std::runtime_error(
+                "binary: File " + filename + " "
+                + (failed ? error : std::string("could not be read by another task")));
+        }
+
+        // the partition of this task
+        mesh::distributed::partition_t<cellT> partition { mito::mesh::mesh<cellT>() };
+
+        // instantiate the nodes and insert the cells (owned cells first, then ghost cells)
+        partition.nodes = binary::nodes<D>(coordinates, coordinate_system);
+        insert(partition.mesh, partition.nodes, connectivity);
+
+        // record the global ids and the owners of the cells and of the nodes
+        partition.n_owned_cells = part.n_owned_cells;
+        partition.cells = std::move(cells);
+        partition.cell_owners.assign(std::begin(cell_owners), std::end(cell_owners));
+        partition.connectivity.assign(std::begin(connectivity), std::end(connectivity));
+        partition.node_ids = std::move(node_ids);
+        partition.node_owners.assign(std::begin(node_owners), std::end(node_owners));
+        partition.node_numbers = std::move(node_numbers);
+        partition.n_nodes = header.n_nodes;
+
+        // all done
+        return partition;
+    }
+}
+
+
+// end of file
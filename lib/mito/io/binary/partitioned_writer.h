@@ -0,0 +1,258 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::binary {
+
+    // write {mesh} to file {filename}.mitp as a partitioned mesh in binary format, with the cells
+    // assigned to the {n_parts} parts in {partitions} (given in the order of iteration on the
+    // cells, e.g. by a metis partition) and {n_layers} layers of ghost cells around each part
+    // This is a serial preprocessing step: each task of a parallel run then reads only the chunk
+    // of its own part with {partitioned_reader}
+    // The global ids of the cells follow the order of iteration on the cells, those of the nodes
+    // follow the point numbering of the mesh; each node is owned by the lowest part owning one of
+    // its cells, and the nodes owned by each part are numbered contiguously (in ascending order of
+    // part, and in ascending order of global id within each part)
+    template <class cellT, geometry::coordinates_c coordT>
+    requires(utilities::same_dim_c<cellT, coordT>)
+    auto partitioned_writer(
+        std::string filename, const mesh::mesh_t<cellT> & mesh,
+        const geometry::coordinate_system_t<coordT> & coordinate_system,
+        std::span<const std::int32_t> partitions, int n_parts, int n_layers = 1) -> void
+    {
+        // the dimension of the physical space
+        constexpr int D = cellT::dim;
+        // the number of nodes per cell
+        constexpr int V = cellT::n_vertices;
+
+        // make a channel
+        journal::info_t channel("mito.binary.partitioned_writer");
+
+        // report
+        channel << "Writing partitioned mesh in " << n_parts << " parts..." << journal::endl;
+
+        // number the points of the mesh (nodes sharing a point are written once)
+        auto numbering = mesh::point_numbering(mesh);
+        const auto & connectivity = numbering.connectivity();
+
+        // the number of nodes and of cells
+        int n_nodes = numbering.size();
+        int n_cells = mesh.nCells();
+
+        // check the partition
+        if (std::ssize(partitions) != n_cells) {
+            throw std::runtime_error("binary: One partition id per cell is expected");
+        }
+        for (auto part : partitions) {
+            if (part < 0 || part >= n_parts) {
+                throw std::runtime_error("binary: Partition id out of range");
+            }
+        }
+
+        // the cells of each node
+        std::vector<int> node_offsets(n_nodes + 1, 0);
+        for (auto node : connectivity) {
+            ++node_offsets[node + 1];
+        }
+        std::partial_sum(
+            std::begin(node_offsets), std::end(node_offsets), std::begin(node_offsets));
+        std::vector<int> node_cells(V * n_cells);
+        {
+            auto position = node_offsets;
+            for (int i = 0; i < V * n_cells; ++i) {
+                node_cells[position[connectivity[i]]++] = i / V;
+            }
+        }
+
+        // the cells of each part, in ascending order of global id
+        std::vector<int> part_offsets(n_parts + 1, 0);
+        for (auto part : partitions) {
+            ++part_offsets[part + 1];
+        }
+        std::partial_sum(
+            std::begin(part_offsets), std::end(part_offsets), std::begin(part_offsets));
+        std::vector<int> part_cells(n_cells);
+        {
+            auto position = part_offsets;
+            for (int e = 0; e < n_cells; ++e) {
+                part_cells[position[partitions[e]]++] = e;
+            }
+        }
+
+        // the owner of each node: the lowest part owning one of its cells
+        std::vector<std::int32_t> node_owners(n_nodes, n_parts);
+        for (int i = 0; i < V * n_cells; ++i) {
+            auto & owner = node_owners[connectivity[i]];
+            owner = std::min(owner, partitions[i / V]);
+        }
+
+        // the global number of each node
+        std::vector<std::int64_t> node_numbers(n_nodes);
+        {
+            std::vector<std::int64_t> next(n_parts + 1, 0);
+            for (auto owner : node_owners) {
+                ++next[owner + 1];
+            }
+            std::partial_sum(std::begin(next), std::end(next), std::begin(next));
+            for (int n = 0; n < n_nodes; ++n) {
+                node_numbers[n] = next[node_owners[n]]++;
+            }
+        }
+
+        // the coordinates of the points, in the order of their numbers
+        std::vector<double> coordinates(D * n_nodes);
+        for (int n = 0; n < n_nodes; ++n) {
+            const auto & coord = coordinate_system.coordinates(numbering.node(n)->point());
+            for (int d = 0; d < D; ++d) {
+                coordinates[D * n + d] = coord[d];
+            }
+        }
+
+        // fill in the header
+        partitioned_header_t header;
+        header.dim = D;
+        header.cell_type = summit::cell<cellT>::type;
+        header.n_vertices = V;
+        header.n_parts = n_parts;
+        header.n_layers = n_layers;
+        header.n_nodes = n_nodes;
+        header.n_cells = n_cells;
+        header.index_offset = align(sizeof(partitioned_header_t));
+
+        // the index, filled in as the chunks are written
+        std::vector<part_t> index(n_parts);
+
+        // create the output file
+        filename += ".mitp";
+        std::ofstream outfile(filename, std::ios::binary);
+        if (!outfile.is_open()) {
+            throw std::runtime_error("binary: File " + filename + " could not be created");
+        }
+
+        // the current position in the file
+        std::int64_t position = 0;
+
+        // helper function to write the {values} at {offset}, padding with zeros
+        auto _write = [&outfile, &position](std::int64_t offset, const auto & values) {
+            static constexpr std::array<char, alignment> zeros = {};
+            auto bytes = std::as_bytes(std::span(values));
+            outfile.write(zeros.data(), offset - position);
+            outfile.write(reinterpret_cast<const char *>(bytes.data()), std::size(bytes));
+            position = offset + std::size(bytes);
+        };
+
+        // write the header and room for the index
+        _write(0, std::span(&header, 1));
+        _write(header.index_offset, index);
+
+        // the part each cell and each node was last marked by, and the local number of each node
+        std::vector<int> cell_marks(n_cells, -1);
+        std::vector<int> node_marks(n_nodes, -1);
+        std::vector<int> local(n_nodes, -1);
+
+        // write the chunk of each part
+        for (int p = 0; p < n_parts; ++p) {
+            // the owned cells
+            std::vector<int> cells(
+                std::begin(part_cells) + part_offsets[p],
+                std::begin(part_cells) + part_offsets[p + 1]);
+            for (auto e : cells) {
+                cell_marks[e] = p;
+            }
+
+            // the ghost cells, layer by layer (in ascending order of global id within each layer)
+            int layer_begin = 0;
+            for (int layer = 0; layer < n_layers; ++layer) {
+                int layer_end = std::size(cells);
+                for (int k = layer_begin; k < layer_end; ++k) {
+                    for (int a = 0; a < V; ++a) {
+                        auto node = connectivity[V * cells[k] + a];
+                        for (int i = node_offsets[node]; i < node_offsets[node + 1]; ++i) {
+                            if (cell_marks[node_cells[i]] != p) {
+                                cell_marks[node_cells[i]] = p;
+                                cells.push_back(node_cells[i]);
+                            }
+                        }
+                    }
+                }
+                std::sort(std::begin(cells) + layer_end, std::end(cells));
+                layer_begin = layer_end;
+            }
+
+            // the sections of the cells, numbering the nodes in order of first appearance
+            std::vector<std::int64_t> cell_ids(std::begin(cells), std::end(cells));
+            std::vector<std::int32_t> cell_owners;
+            std::vector<std::int32_t> cell_nodes;
+            std::vector<std::int64_t> node_ids;
+            cell_owners.reserve(std::size(cells));
+            cell_nodes.reserve(V * std::size(cells));
+            for (auto e : cells) {
+                cell_owners.push_back(partitions[e]);
+                for (int a = 0; a < V; ++a) {
+                    auto node = connectivity[V * e + a];
+                    if (node_marks[node] != p) {
+                        node_marks[node] = p;
+                        local[node] = std::size(node_ids);
+                        node_ids.push_back(node);
+                    }
+                    cell_nodes.push_back(local[node]);
+                }
+            }
+
+            // the sections of the nodes
+            std::vector<std::int32_t> owners;
+            std::vector<std::int64_t> numbers;
+            std::vector<double> x;
+            owners.reserve(std::size(node_ids));
+            numbers.reserve(std::size(node_ids));
+            x.reserve(D * std::size(node_ids));
+            for (auto node : node_ids) {
+                owners.push_back(node_owners[node]);
+                numbers.push_back(node_numbers[node]);
+                x.insert(
+                    std::end(x), std::begin(coordinates) + D * node,
+                    std::begin(coordinates) + D * (node + 1));
+            }
+
+            // lay out the chunk after the previous one
+            auto & part = index[p];
+            part.n_owned_cells = part_offsets[p + 1] - part_offsets[p];
+            part.n_cells = std::size(cells);
+            part.n_nodes = std::size(node_ids);
+            layout(part, position, D, V);
+
+            // write the chunk
+            _write(part.cells_offset, cell_ids);
+            _write(part.cell_owners_offset, cell_owners);
+            _write(part.connectivity_offset, cell_nodes);
+            _write(part.node_ids_offset, node_ids);
+            _write(part.node_owners_offset, owners);
+            _write(part.node_numbers_offset, numbers);
+            _write(part.coordinates_offset, x);
+        }
+
+        // write the header and the index, now complete
+        header.file_size = position;
+        outfile.seekp(0);
+        outfile.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        outfile.seekp(header.index_offset);
+        outfile.write(
+            reinterpret_cast<const char *>(index.data()), std::size(index) * sizeof(part_t));
+
+        // check that everything went well
+        if (!outfile) {
+            throw std::runtime_error("binary: File " + filename + " could not be written");
+        }
+
+        // all done
+        return;
+    }
+}
+
+
+// end of file
@@ -0,0 +1,36 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+// external packages
+#include "externals.h"
+
+// get the forward declarations
+#include "forward.h"
+
+// the file layout
+#include "header.h"
+
+// classes implementation
+#include "MappedFile.h"
+#include "BinaryMesh.h"
+
+// published type factories; this is the file you are looking for...
+#include "api.h"
+
+// read, write and convert functions
+#include "writer.h"
+#include "reader.h"
+#include "converter.h"
+#include "partitioned_writer.h"
+#ifdef WITH_MPI
+#include "partitioned_reader.h"
+#endif
+
+
+// end of file
@@ -0,0 +1,163 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::binary {
+
+    // instantiate the nodes at {coordinates} ({D} per node) in {coordinate_system}
+    template <int D, geometry::coordinates_c coordT>
+    auto nodes(
+        std::span<const double> coordinates,
+        geometry::coordinate_system_t<coordT> & coordinate_system)
+        -> std::vector<geometry::node_t<D>>
+    {
+        // the number of nodes
+        int n_nodes = std::size(coordinates) / D;
+
+        // instantiate the nodes
+        std::vector<geometry::node_t<D>> nodes;
+        nodes.reserve(n_nodes);
+        for (int n = 0; n < n_nodes; ++n) {
+            // the coordinates of the node
+            tensor::vector_t<D> x;
+            for (int d = 0; d < D; ++d) {
+                x[d] = coordinates[D * n + d];
+            }
+
+            // instantiate a new node
+            nodes.push_back(mito::geometry::node(coordinate_system, coordT(x)));
+        }
+
+        // all done
+        return nodes;
+    }
+
+    // insert in {mesh} the cells with the {nodes} numbered in {connectivity}, tagging each cell
+    // with its entry in {tags} (if any; zero tags are not stored)
+    template <summit::GalerkinMeshType galerkinT = summit::CG, class cellT, class nodeT>
+    auto insert(
+        mesh::mesh_t<cellT> & mesh, const std::vector<nodeT> & nodes,
+        std::span<const std::int32_t> connectivity, std::span<const int> tags = {}) -> void
+    {
+        // if it is a continuous Galerkin mesh
+        if constexpr (galerkinT == summit::CG) {
+            // insert in the mesh the geometric simplices with these nodes, all at once
+            mesh.insert(nodes, connectivity, tags);
+        }
+        // otherwise
+        else {
+            // assert that it is then a discontinuous Galerkin mesh
+            static_assert(galerkinT == summit::DG);
+
+            // the dimension of the physical space
+            constexpr int D = cellT::dim;
+
+            // the number of nodes per cell
+            constexpr int N = cellT::n_vertices;
+
+            // the number of nodes and of cells
+            int n_nodes = std::size(nodes);
+            int n_cells = std::size(connectivity) / N;
+
+            // helper function to fetch the {a}-th node of the {e}-th cell
+            auto _node = [&nodes, &connectivity, n_nodes](int e, int a) -> const auto & {
+                auto index = connectivity[N * e + a];
+                if (index < 0 || index >= n_nodes) {
+                    throw std::runtime_error("reader: Mesh file has invalid connectivity");
+                }
+                return nodes[index];
+            };
+
+            // make room for the tags of the cells
+            if (!std::empty(tags)) {
+                mesh.reserve_tags(n_cells);
+            }
+
+            // insert the cells
+            for (int e = 0; e < n_cells; ++e) {
+                // insert in the mesh a geometric simplex with a new instance of the nodes riding
+                // on same vertex and same point
+                auto & cell = [&]<int... a>(std::integer_sequence<int, a...>) -> auto & {
+                    return mesh.insert(
+                        { geometry::node_t<D>(_node(e, a)->vertex(), _node(e, a)->point())... });
+                }(std::make_integer_sequence<int, N>{});
+
+                // store the tag of the cell
+                if (!std::empty(tags) && tags[e] != 0) {
+                    mesh.tag(cell, tags[e]);
+                }
+            }
+        }
+
+        // all done
+        return;
+    }
+
+    // build a mesh of cells of type {cellT} from the {coordinates} of its nodes, the
+    // {connectivity} of its cells and their {tags} (if any), e.g. views of a file mapped in memory
+    template <
+        class cellT, summit::GalerkinMeshType galerkinT = summit::CG,
+        geometry::coordinates_c coordT>
+    auto reader(
+        std::span<const double> coordinates, std::span<const std::int32_t> connectivity,
+        geometry::coordinate_system_t<coordT> & coordinate_system,
+        std::span<const std::int32_t> tags = {}) -> mesh::mesh_t<cellT>
+    requires(utilities::same_dim_c<cellT, coordT>)
+    {
+        // make a channel
+        journal::info_t channel("mito.binary.mesh_reader");
+
+        // report
+        channel << "Loading binary mesh..." << journal::endl;
+
+        // instantiate the nodes
+        auto nodes = binary::nodes<cellT::dim>(coordinates, coordinate_system);
+
+        // instantiate mesh
+        auto mesh = mesh::mesh<cellT>();
+
+        // insert the cells
+        insert<galerkinT>(mesh, nodes, connectivity, tags);
+
+        // all done
+        return mesh;
+    }
+
+    // build a mesh of cells of type {cellT} from the views of the mesh file {file}
+    template <
+        class cellT, summit::GalerkinMeshType galerkinT = summit::CG,
+        geometry::coordinates_c coordT>
+    auto reader(const BinaryMesh & file, geometry::coordinate_system_t<coordT> & coordinate_system)
+        -> mesh::mesh_t<cellT>
+    requires(utilities::same_dim_c<cellT, coordT>)
+    {
+        // check that the file holds cells of the expected type
+        if (file.dim() != cellT::dim || file.header().cell_type != summit::cell<cellT>::type) {
+            throw std::runtime_error("reader: Mesh file holds cells of a different type");
+        }
+
+        // build the mesh from the views of the coordinates, of the connectivity and of the tags
+        return reader<cellT, galerkinT>(
+            file.coordinates(), file.connectivity(), coordinate_system, file.tags());
+    }
+
+    // read a mesh of cells of type {cellT} from the mesh file {filename} in binary format
+    template <
+        class cellT, summit::GalerkinMeshType galerkinT = summit::CG,
+        geometry::coordinates_c coordT>
+    auto reader(
+        const std::string & filename, geometry::coordinate_system_t<coordT> & coordinate_system)
+        -> mesh::mesh_t<cellT>
+    requires(utilities::same_dim_c<cellT, coordT>)
+    {
+        return reader<cellT, galerkinT>(BinaryMesh(filename), coordinate_system);
+    }
+}
+
+
+// end of file
@@ -0,0 +1,119 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::binary {
+
+    // write to {filename} a mesh in binary format with cells of summit type {cell_type} and
+    // {n_vertices} nodes each, given the {coordinates} of its nodes in a space of dimension {dim},
+    // the {connectivity} of its cells, and optionally their {tags} and {partitions}
+    inline auto write(
+        const std::string & filename, int dim, int cell_type, int n_vertices,
+        std::span<const double> coordinates, std::span<const std::int32_t> connectivity,
+        std::span<const std::int32_t> tags = {}, std::span<const std::int32_t> partitions = {})
+        -> void
+    {
+        // fill in the header
+        header_t header;
+        header.dim = dim;
+        header.cell_type = cell_type;
+        header.n_vertices = n_vertices;
+        header.n_nodes = std::size(coordinates) / dim;
+        header.n_cells = std::size(connectivity) / n_vertices;
+        header.has_tags = !std::empty(tags);
+        header.has_partitions = !std::empty(partitions);
+        layout(header);
+
+        // check the sizes of the sections
+        if (header.has_tags && std::ssize(tags) != header.n_cells) {
+            throw std::runtime_error("binary: One tag per cell is expected");
+        }
+        if (header.has_partitions && std::ssize(partitions) != header.n_cells) {
+            throw std::runtime_error("binary: One partition id per cell is expected");
+        }
+
+        // create the output file
+        std::ofstream outfile(filename, std::ios::binary);
+        if (!outfile.is_open()) {
+            throw std::runtime_error("binary: File " + filename + " could not be created");
+        }
+
+        // the current position in the file
+        std::int64_t position = 0;
+
+        // helper function to write {size} bytes of {data} at {offset}, padding with zeros
+        auto _write = [&outfile, &position](std::int64_t offset, const void * data,
+                                            std::int64_t size) {
+            static constexpr std::array<char, alignment> zeros = {};
+            outfile.write(zeros.data(), offset - position);
+            outfile.write(static_cast<const char *>(data), size);
+            position = offset + size;
+        };
+
+        // write the header and the sections
+        _write(0, &header, sizeof(header_t));
+        _write(header.coordinates_offset, coordinates.data(), coordinates.size_bytes());
+        _write(header.connectivity_offset, connectivity.data(), connectivity.size_bytes());
+        if (header.has_tags) {
+            _write(header.tags_offset, tags.data(), tags.size_bytes());
+        }
+        if (header.has_partitions) {
+            _write(header.partitions_offset, partitions.data(), partitions.size_bytes());
+        }
+
+        // check that everything went well
+        if (!outfile) {
+            throw std::runtime_error("binary: File " + filename + " could not be written");
+        }
+
+        // all done
+        return;
+    }
+
+    // write {mesh} to file {filename}.mito in binary format, with the (optional) {tags} and
+    // {partitions} of the cells given in the order of iteration on the cells
+    template <class cellT, geometry::coordinates_c coordT>
+    requires(utilities::same_dim_c<cellT, coordT>)
+    auto writer(
+        std::string filename, const mesh::mesh_t<cellT> & mesh,
+        const geometry::coordinate_system_t<coordT> & coordinate_system,
+        std::span<const std::int32_t> tags = {}, std::span<const std::int32_t> partitions = {})
+        -> void
+    {
+        // the dimension of the physical space
+        constexpr int D = cellT::dim;
+
+        // number the points of the mesh (nodes sharing a point are written once)
+        auto numbering = mesh::point_numbering(mesh);
+
+        // the nodes must be addressable by int32 indices
+        if (numbering.size() > std::numeric_limits<std::int32_t>::max()) {
+            throw std::runtime_error("binary: Too many nodes for int32 connectivity");
+        }
+
+        // the coordinates of the points, in the order of their numbers
+        std::vector<double> coordinates(D * numbering.size());
+        for (int n = 0; n < numbering.size(); ++n) {
+            const auto & coord = coordinate_system.coordinates(numbering.node(n)->point());
+            for (int d = 0; d < D; ++d) {
+                coordinates[D * n + d] = coord[d];
+            }
+        }
+
+        // write the file (the connectivity of the cells is written straight from the numbering)
+        write(
+            filename + ".mito", D, summit::cell<cellT>::type, cellT::n_vertices, coordinates,
+            numbering.connectivity(), tags, partitions);
+
+        // all done
+        return;
+    }
+}
+
+
+// end of file
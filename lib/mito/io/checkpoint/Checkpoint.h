@@ -0,0 +1,243 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::checkpoint {
+
+    // a checkpoint read back from file: the file of this task is mapped in memory and its sections
+    // are viewed in place, so that the mesh, the function space, the discrete systems and the
+    // fields are rebuilt in bulk from them
+    class Checkpoint {
+
+      public:
+        // constructor from the name of the checkpoint
+        inline Checkpoint(const std::string & filename) :
+            _file(path(filename)),
+            _header(),
+            _table()
+        {
+            // the name of the file of this task
+            auto name = path(filename);
+
+            // check that the file holds a header
+            if (_file.size() < sizeof(header_t)) {
+                throw std::runtime_error("checkpoint: File " + name + " is too short");
+            }
+
+            // read the header
+            std::memcpy(&_header, _file.data(), sizeof(header_t));
+
+            // check the magic string, the byte order and the version
+            if (_header.magic != header_t().magic) {
+                throw std::runtime_error("checkpoint: File " + name + " is not a mito checkpoint");
+            }
+            if (_header.byte_order != header_t().byte_order) {
+                throw std::runtime_error("checkpoint: File " + name + " has wrong byte order");
+            }
+            if (_header.version != header_t().version) {
+                throw std::runtime_error("checkpoint: File " + name + " has unknown version");
+            }
+
+            // check that the checkpoint was written by a run with as many tasks as this one
+            if (_header.n_tasks != tasks().second) {
+                throw std::runtime_error(
+                    "checkpoint: File " + name + " was written by a run with "
+                    + std::to_string(_header.n_tasks) + " tasks");
+            }
+
+            // check that the file is complete
+            auto table_end = sizeof(header_t) + _header.n_sections * sizeof(section_t);
+            if (_header.n_sections < 0 || _file.size() < table_end
+                || static_cast<std::int64_t>(_file.size()) < _header.file_size) {
+                throw std::runtime_error("checkpoint: File " + name + " is corrupted");
+            }
+
+            // read the table of sections
+            _table.resize(_header.n_sections);
+            std::memcpy(
+                _table.data(), _file.data() + sizeof(header_t),
+                _header.n_sections * sizeof(section_t));
+
+            // check that the sections are within the file
+            for (const auto & section : _table) {
+                auto item_size = section.type == FLOAT64 ? sizeof(double) : sizeof(std::int32_t);
+                if (section.name.back() != '\0' || section.offset % binary::alignment != 0
+                    || section.offset + section.size * section.n_components * item_size
+                           > static_cast<std::size_t>(_header.file_size)) {
+                    throw std::runtime_error("checkpoint: File " + name + " is corrupted");
+                }
+            }
+        }
+
+        // destructor
+        inline ~Checkpoint() = default;
+
+        // move constructor
+        inline Checkpoint(Checkpoint &&) noexcept = default;
+
+      private:
+        // delete copy constructor
+        Checkpoint(const Checkpoint &) = delete;
+
+        // delete assignment operator
+        Checkpoint & operator=(const Checkpoint &) = delete;
+
+        // delete move assignment operator
+        Checkpoint & operator=(Checkpoint &&) noexcept = delete;
+
+      private:
+        // the entry of section {name}
+        inline auto _section(const std::string & name) const -> const section_t &
+        {
+            for (const auto & section : _table) {
+                if (name == section.name.data()) {
+                    return section;
+                }
+            }
+            throw std::runtime_error("checkpoint: No section " + name);
+        }
+
+      public:
+        // the header of the file
+        inline auto header() const noexcept -> const header_t & { return _header; }
+
+        // whether the checkpoint holds section {name}
+        inline auto has(const std::string & name) const -> bool
+        {
+            return std::any_of(std::begin(_table), std::end(_table), [&name](const auto & section) {
+                return name == section.name.data();
+            });
+        }
+
+        // a view of the items of section {name}, of type {T} with {n_components} per item
+        template <class T>
+        auto section(const std::string & name, int n_components) const -> std::span<const T>
+        {
+            // the entry of the section
+            const auto & section = _section(name);
+
+            // check the layout of the items
+            if (section.type != section_type<T>() || section.n_components != n_components) {
+                throw std::runtime_error("checkpoint: Section " + name + " has wrong layout");
+            }
+
+            // the sections are aligned in the file, and the mapping is page-aligned
+            return { reinterpret_cast<const T *>(_file.data() + section.offset),
+                     static_cast<std::size_t>(section.size * n_components) };
+        }
+
+        // rebuild the mesh of cells of type {cellT}, with the points in {coordinate_system}
+        template <
+            class cellT, summit::GalerkinMeshType galerkinT = summit::CG,
+            geometry::coordinates_c coordT>
+        requires(utilities::same_dim_c<cellT, coordT>)
+        auto mesh(geometry::coordinate_system_t<coordT> & coordinate_system) const
+            -> mesh::mesh_t<cellT>
+        {
+            return binary::reader<cellT, galerkinT>(
+                section<double>("mesh.coordinates", cellT::dim),
+                section<int>("mesh.cells", cellT::n_vertices), coordinate_system);
+        }
+
+        // rebuild the function space of elements of type {elementT} on {manifold} (which must be
+        // built on the restored mesh) subject to {constraints}
+        template <
+            class elementT, manifolds::manifold_c manifoldT, constraints::constraint_c constraintsT>
+        auto function_space(const manifoldT & manifold, const constraintsT & constraints) const
+            -> fem::function_space_t<elementT, constraintsT>
+        {
+            return fem::function_space_t<elementT, constraintsT>(
+                manifold, constraints,
+                section<int>("function_space.element_nodes", elementT::n_nodes),
+                section<int>("function_space.constrained", 1));
+        }
+
+        // rebuild the discrete system recorded under {name} on the restored {function_space}, with
+        // the restored equation map (the solution is restored by {restore})
+        template <class linearSystemT, fem::function_space_c functionSpaceT, class weakformT>
+        auto discrete_system(
+            const std::string & name, const functionSpaceT & function_space,
+            const weakformT & weakform) const
+            -> fem::discrete_system_t<functionSpaceT, linearSystemT>
+        {
+            return fem::discrete_system_t<functionSpaceT, linearSystemT>(
+                name, function_space, weakform, section<int>(name + ".equations", 1));
+        }
+
+        // restore the nodal values of {field} on the restored {function_space} from the field
+        // recorded under {name}
+        template <fem::function_space_c functionSpaceT, class Y>
+        auto restore(
+            const functionSpaceT & function_space, fem::fem_field_t<Y, functionSpaceT> & field,
+            const std::string & name) const -> void
+        {
+            // the number of components of the field
+            constexpr int n = io::n_components<Y>();
+
+            // the discretization nodes in the order of their numbers
+            auto nodes = fem::number_discretization_nodes(function_space).first;
+
+            // the recorded values
+            auto values = section<double>(name, n);
+            if (std::size(values) != n * std::size(nodes)) {
+                throw std::runtime_error("checkpoint: Section " + name + " has wrong size");
+            }
+
+            // copy the values to the field
+            for (int i = 0; i < std::ssize(nodes); ++i) {
+                auto & value = field(nodes[i]);
+                if constexpr (std::is_arithmetic_v<Y>) {
+                    value = values[i];
+                } else {
+                    std::copy_n(std::begin(values) + n * i, n, std::begin(value));
+                }
+            }
+
+            // all done
+            return;
+        }
+
+        // restore the solution of the discrete system {system} on the restored {function_space}
+        // from the discrete system recorded under {name}
+        template <fem::function_space_c functionSpaceT, class linearSystemT>
+        auto restore(
+            const functionSpaceT & function_space,
+            fem::discrete_system_t<functionSpaceT, linearSystemT> & system,
+            const std::string & name) const -> void
+        {
+            return restore(function_space, system.solution(), name + ".solution");
+        }
+
+        // rebuild the finite element field of values of type {Y} recorded under {name} on the
+        // restored {function_space}
+        template <class Y, fem::function_space_c functionSpaceT>
+        auto fem_field(const functionSpaceT & function_space, const std::string & name) const
+            -> fem::fem_field_t<Y, functionSpaceT>
+        {
+            // a field on the discretization nodes
+            auto field = function_space.template fem_field<Y>(name);
+
+            // restore its values
+            restore(function_space, field, name);
+
+            // all done
+            return field;
+        }
+
+      private:
+        // the file mapped in memory
+        binary::MappedFile _file;
+        // the header of the file
+        header_t _header;
+        // the table of sections
+        std::vector<section_t> _table;
+    };
+}
+
+
+// end of file
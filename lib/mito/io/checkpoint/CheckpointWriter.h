@@ -0,0 +1,245 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::checkpoint {
+
+    // a writer of a checkpoint of a function space on a manifold and of fields on it: the mesh
+    // connectivity, the coordinates of the points, the numbering of the discretization nodes of
+    // each element and the constrained nodes are stored together with the nodal values of the
+    // recorded fields and the equation maps of the recorded discrete systems, so that a restart
+    // rebuilds all of them in bulk
+    template <manifolds::manifold_c manifoldT, fem::function_space_c functionSpaceT>
+    class CheckpointWriter {
+
+      private:
+        // the manifold type
+        using manifold_type = manifoldT;
+        // the function space type
+        using function_space_type = functionSpaceT;
+        // the mesh type
+        using mesh_type = typename manifold_type::mesh_type;
+        // the discretization node type
+        using node_type = typename function_space_type::discretization_node_type;
+        // the dimension of the physical space
+        static constexpr int D = mesh_type::dim;
+        // the number of vertices per cell
+        static constexpr int N = mesh_type::cell_type::n_vertices;
+        // the number of discretization nodes per element
+        static constexpr int n_element_nodes = function_space_type::element_type::n_nodes;
+
+        // a section waiting to be written
+        struct pending_section_t {
+            // the entry of the section in the table
+            section_t section;
+            // the items of the section
+            std::vector<std::byte> bytes;
+        };
+
+      public:
+        // constructor
+        CheckpointWriter(
+            std::string filename, const manifold_type & manifold,
+            const function_space_type & function_space) :
+            _filename(filename),
+            _nodes(),
+            _sections()
+        {
+            // number the points of the mesh
+            auto numbering = mesh::point_numbering(manifold.mesh());
+
+            // the coordinates of the points in the order of their numbers
+            std::vector<double> coordinates(D * numbering.size());
+            for (int n = 0; n < numbering.size(); ++n) {
+                const auto & x =
+                    manifold.coordinate_system().coordinates(numbering.node(n)->point());
+                for (int d = 0; d < D; ++d) {
+                    coordinates[D * n + d] = x[d];
+                }
+            }
+            _add<double>("mesh.coordinates", D, coordinates);
+
+            // the connectivity of the cells
+            _add<int>("mesh.cells", N, numbering.connectivity());
+
+            // number the discretization nodes
+            auto [nodes, element_nodes] = fem::number_discretization_nodes(function_space);
+            _nodes = std::move(nodes);
+            _add<int>("function_space.element_nodes", n_element_nodes, element_nodes);
+
+            // the numbers of the nodes
+            std::unordered_map<utilities::index_t<node_type>, int> numbers;
+            for (int n = 0; n < std::ssize(_nodes); ++n) {
+                numbers[_nodes[n].id()] = n;
+            }
+
+            // the constrained nodes
+            std::vector<int> constrained;
+            for (const auto & node : function_space.constrained_nodes()) {
+                constrained.push_back(numbers.at(node.id()));
+            }
+            std::sort(std::begin(constrained), std::end(constrained));
+            _add<int>("function_space.constrained", 1, constrained);
+        }
+
+        // destructor
+        ~CheckpointWriter() = default;
+
+        // move constructor
+        CheckpointWriter(CheckpointWriter &&) = default;
+
+      private:
+        // delete copy constructor
+        CheckpointWriter(const CheckpointWriter &) = delete;
+
+        // delete assignment operator
+        CheckpointWriter & operator=(const CheckpointWriter &) = delete;
+
+        // delete move assignment operator
+        CheckpointWriter & operator=(CheckpointWriter &&) = delete;
+
+      private:
+        // add section {name} with {items} of type {T}, {n_components} per item
+        template <class T>
+        auto _add(const std::string & name, int n_components, std::span<const T> items) -> void
+        {
+            // check that the name fits in the table
+            section_t section;
+            if (std::size(name) >= std::size(section.name)) {
+                throw std::runtime_error("checkpoint: Section name " + name + " is too long");
+            }
+
+            // check that there is no other section with the same name
+            for (const auto & other : _sections) {
+                if (name == other.section.name.data()) {
+                    throw std::runtime_error("checkpoint: Section " + name + " already recorded");
+                }
+            }
+
+            // fill in the entry of the section
+            std::copy(std::begin(name), std::end(name), std::begin(section.name));
+            section.type = section_type<T>();
+            section.n_components = n_components;
+            section.size = std::size(items) / n_components;
+
+            // store the items
+            auto bytes = std::as_bytes(items);
+            _sections.push_back({ section, { std::begin(bytes), std::end(bytes) } });
+
+            // all done
+            return;
+        }
+
+      public:
+        // record the nodal values of the finite element field {field} under {name}
+        template <class Y>
+        auto record(const fem::fem_field_t<Y, function_space_type> & field, std::string name)
+            -> void
+        {
+            // the number of components of the field
+            constexpr int n = io::n_components<Y>();
+
+            // collect the values of the field in the order of the numbers of the nodes
+            std::vector<double> values(n * std::size(_nodes));
+            for (int i = 0; i < std::ssize(_nodes); ++i) {
+                const auto & value = field(_nodes[i]);
+                if constexpr (std::is_arithmetic_v<Y>) {
+                    values[i] = value;
+                } else {
+                    std::copy(std::begin(value), std::end(value), std::begin(values) + n * i);
+                }
+            }
+
+            // add the section
+            return _add<double>(name, n, values);
+        }
+
+        // record the equation map and the solution of the discrete system {system} under {name}
+        template <class linearSystemT>
+        auto record(
+            const fem::discrete_system_t<function_space_type, linearSystemT> & system,
+            std::string name) -> void
+        {
+            // collect the equation numbers in the order of the numbers of the nodes
+            std::vector<int> equations(std::size(_nodes));
+            const auto & equation_map = system.equation_map();
+            for (int i = 0; i < std::ssize(_nodes); ++i) {
+                equations[i] = equation_map.at(_nodes[i]);
+            }
+            _add<int>(name + ".equations", 1, equations);
+
+            // record the solution
+            return record(system.solution(), name + ".solution");
+        }
+
+        // write the checkpoint to file
+        auto write() const -> void
+        {
+            // the id of this task and the number of tasks
+            auto [task_id, n_tasks] = tasks();
+
+            // the header
+            header_t header;
+            header.task = task_id;
+            header.n_tasks = n_tasks;
+            header.n_sections = std::size(_sections);
+
+            // lay out the sections after the table
+            std::vector<section_t> table;
+            auto end = static_cast<std::int64_t>(
+                sizeof(header_t) + std::size(_sections) * sizeof(section_t));
+            for (const auto & [section, bytes] : _sections) {
+                table.push_back(section);
+                table.back().offset = binary::align(end);
+                end = table.back().offset + std::ssize(bytes);
+            }
+            header.file_size = end;
+
+            // create the output file
+            auto filename = path(_filename);
+            std::ofstream outfile(filename, std::ios::binary);
+
+            // write the header and the table
+            outfile.write(reinterpret_cast<const char *>(&header), sizeof(header_t));
+            outfile.write(
+                reinterpret_cast<const char *>(table.data()), std::size(table) * sizeof(section_t));
+
+            // write the sections, padded to their offsets
+            std::int64_t position = sizeof(header_t) + std::size(table) * sizeof(section_t);
+            std::array<char, binary::alignment> padding = {};
+            for (int s = 0; s < std::ssize(table); ++s) {
+                outfile.write(padding.data(), table[s].offset - position);
+                const auto & bytes = _sections[s].bytes;
+                outfile.write(reinterpret_cast<const char *>(bytes.data()), std::size(bytes));
+                position = table[s].offset + std::ssize(bytes);
+            }
+
+            // close the file
+            outfile.close();
+
+            // check that everything went well
+            if (!outfile) {
+                throw std::runtime_error("checkpoint: File " + filename + " could not be written");
+            }
+
+            // all done
+            return;
+        }
+
+      private:
+        // the name of the checkpoint
+        std::string _filename;
+        // the discretization nodes in the order of their numbers
+        std::vector<node_type> _nodes;
+        // the sections to be written
+        std::vector<pending_section_t> _sections;
+    };
+}
+
+
+// end of file
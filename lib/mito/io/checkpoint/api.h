@@ -0,0 +1,30 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::checkpoint {
+
+    // checkpoint alias
+    using checkpoint_t = Checkpoint;
+
+    // checkpoint writer alias
+    template <manifolds::manifold_c manifoldT, fem::function_space_c functionSpaceT>
+    using writer_t = CheckpointWriter<manifoldT, functionSpaceT>;
+
+    // checkpoint writer factory
+    template <manifolds::manifold_c manifoldT, fem::function_space_c functionSpaceT>
+    auto writer(
+        std::string filename, const manifoldT & manifold, const functionSpaceT & function_space)
+        -> writer_t<manifoldT, functionSpaceT>;
+
+    // restart factory (reads back the checkpoint {filename} written by this task)
+    inline auto restart(const std::string & filename) -> checkpoint_t;
+}
+
+
+// end of file
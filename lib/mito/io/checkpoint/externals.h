@@ -0,0 +1,33 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+// externals
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#ifdef WITH_MPI
+#include <mpi.h>
+#endif    // WITH_MPI
+
+// support
+#include "../../fem.h"
+#include "../binary/public.h"
+
+
+// end of file
@@ -0,0 +1,29 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::checkpoint {
+
+    // checkpoint writer factory
+    template <manifolds::manifold_c manifoldT, fem::function_space_c functionSpaceT>
+    auto writer(
+        std::string filename, const manifoldT & manifold, const functionSpaceT & function_space)
+        -> writer_t<manifoldT, functionSpaceT>
+    {
+        return writer_t<manifoldT, functionSpaceT>(filename, manifold, function_space);
+    }
+
+    // restart factory
+    inline auto restart(const std::string & filename) -> checkpoint_t
+    {
+        return checkpoint_t(filename);
+    }
+}
+
+
+// end of file
@@ -0,0 +1,24 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::checkpoint {
+
+    // the types of the items of a section of a checkpoint
+    enum SectionType { INT32, FLOAT64 };
+
+    // class for a checkpoint read back from file
+    class Checkpoint;
+
+    // class for the writer of a checkpoint of a function space and of its fields
+    template <manifolds::manifold_c manifoldT, fem::function_space_c functionSpaceT>
+    class CheckpointWriter;
+}
+
+
+// end of file
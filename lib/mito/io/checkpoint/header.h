@@ -0,0 +1,98 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::checkpoint {
+
+    // the header of a checkpoint file
+    // The header is followed by a table of {n_sections} sections, then by the items of each
+    // section in native byte order, starting at the offset recorded in the table and aligned like
+    // the sections of a binary mesh file, so that they can be viewed in place once the file is
+    // mapped in memory
+    struct header_t {
+        // the magic string identifying the format
+        std::array<char, 8> magic = { 'M', 'I', 'T', 'O', 'C', 'K', 'P', '\0' };
+        // the byte order mark (reads differently on a machine with the other endianness)
+        std::uint32_t byte_order = 0x01020304;
+        // the version of the format
+        std::int32_t version = 1;
+        // the task that wrote the file and the number of tasks of the run
+        std::int32_t task = 0;
+        std::int32_t n_tasks = 1;
+        // the number of sections
+        std::int32_t n_sections = 0;
+        // padding
+        std::int32_t reserved = 0;
+        // the size in bytes of the file
+        std::int64_t file_size = 0;
+    };
+
+    // an entry of the table of sections
+    struct section_t {
+        // the name of the section (null-terminated)
+        std::array<char, 48> name = {};
+        // the type of the items
+        std::int32_t type = INT32;
+        // the number of components per item
+        std::int32_t n_components = 1;
+        // the number of items
+        std::int64_t size = 0;
+        // the offset in bytes of the items from the beginning of the file
+        std::int64_t offset = 0;
+    };
+
+    // the header and the table must be copied to and from the file verbatim
+    static_assert(std::is_trivially_copyable_v<header_t>);
+    static_assert(std::is_trivially_copyable_v<section_t>);
+
+    // the id of this task and the number of tasks of the run
+    inline auto tasks() -> std::pair<int, int>
+    {
+#ifdef WITH_MPI
+        // if MPI is running, ask the world communicator
+        int initialized = 0;
+        MPI_Initialized(&initialized);
+        if (initialized) {
+            int task_id = 0;
+            int n_tasks = 1;
+            MPI_Comm_rank(MPI_COMM_WORLD, &task_id);
+            MPI_Comm_size(MPI_COMM_WORLD, &n_tasks);
+            return { task_id, n_tasks };
+        }
+#endif    // WITH_MPI
+
+        // otherwise, this is a serial run
+        return { 0, 1 };
+    }
+
+    // the name of the file of checkpoint {filename} written by this task (one file per task in
+    // parallel runs)
+    inline auto path(const std::string & filename) -> std::string
+    {
+        auto [task_id, n_tasks] = tasks();
+        if (n_tasks > 1) {
+            return filename + "_" + std::to_string(task_id) + ".ckpt";
+        }
+        return filename + ".ckpt";
+    }
+
+    // the type of a section of items of type {T}
+    template <class T>
+    constexpr auto section_type() -> SectionType
+    {
+        if constexpr (std::is_same_v<T, double>) {
+            return FLOAT64;
+        } else {
+            static_assert(std::is_same_v<T, int> && sizeof(int) == sizeof(std::int32_t));
+            return INT32;
+        }
+    }
+}
+
+
+// end of file
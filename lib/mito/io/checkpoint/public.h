@@ -0,0 +1,30 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+// external packages
+#include "externals.h"
+
+// get the forward declarations
+#include "forward.h"
+
+// the file layout
+#include "header.h"
+
+// published type factories; this is the file you are looking for...
+#include "api.h"
+
+// classes implementation
+#include "CheckpointWriter.h"
+#include "Checkpoint.h"
+
+// factories implementation
+#include "factories.h"
+
+
+// end of file
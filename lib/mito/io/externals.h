@@ -8,6 +8,14 @@
 
 
 // externals
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <type_traits>
 #include <unordered_set>
 
 // support
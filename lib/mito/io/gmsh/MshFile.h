@@ -0,0 +1,489 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::gmsh {
+
+    // the contents of a mesh file in gmsh format (version 4.1, ASCII or binary), with the nodes
+    // and the elements of each dimension (points, segments, triangles and tetrahedra) gathered in
+    // dense arrays
+    // The file is mapped in memory and parsed in place; the nodes are numbered 0, ..., n - 1 in
+    // the order they appear in the file, and each element carries the first physical tag of the
+    // entity it belongs to (0 if the entity has no physical tag)
+    class MshFile {
+
+      public:
+        // the elements of one dimension
+        struct elements_t {
+            // the numbers of the nodes of the elements, {dim + 1} per element
+            std::vector<std::int32_t> connectivity;
+            // the physical tag of each element
+            std::vector<int> tags;
+        };
+
+      private:
+        // a cursor on the contents of a section, read as text or as binary data
+        struct cursor_t {
+            // the current position
+            const char * p;
+            // the end of the file
+            const char * end;
+            // whether the data are binary
+            bool binary;
+
+            // read the next item of type {T}
+            template <class T>
+            inline auto read() -> T
+            {
+                // parse the text
+                if (!binary) {
+                    return summit::parseNumber<T>(p, end);
+                }
+
+                // copy the bytes
+                if (end - p < std::ptrdiff_t(sizeof(T))) {
+                    throw std::runtime_error("gmsh: Mesh file ended unexpectedly");
+                }
+                T value;
+                std::memcpy(&value, p, sizeof(T));
+                p += sizeof(T);
+
+                // all done
+                return value;
+            }
+
+            // read the next {n} items of type {T} into {values}
+            template <class T>
+            inline auto read(T * values, std::size_t n) -> void
+            {
+                // parse the text
+                if (!binary) {
+                    for (std::size_t i = 0; i < n; ++i) {
+                        values[i] = summit::parseNumber<T>(p, end);
+                    }
+                    return;
+                }
+
+                // copy the bytes in bulk
+                if (std::size_t(end - p) < n * sizeof(T)) {
+                    throw std::runtime_error("gmsh: Mesh file ended unexpectedly");
+                }
+                std::memcpy(values, p, n * sizeof(T));
+                p += n * sizeof(T);
+
+                // all done
+                return;
+            }
+        };
+
+        // the dimension of the elements of the supported gmsh types (points, segments, triangles
+        // and tetrahedra), or -1 for the others
+        static constexpr auto element_dimension(int type) -> int
+        {
+            switch (type) {
+                case 15:
+                    return 0;
+                case 1:
+                    return 1;
+                case 2:
+                    return 2;
+                case 4:
+                    return 3;
+                default:
+                    return -1;
+            }
+        }
+
+      public:
+        // constructor from the name of the file
+        inline MshFile(const std::string & filename) :
+            _binary(false),
+            _coordinates(),
+            _elements(),
+            _names(),
+            _entities(),
+            _numbers(),
+            _first_tag(0)
+        {
+            // map the file in memory
+            binary::MappedFile file(filename);
+            const char * p = reinterpret_cast<const char *>(file.data());
+            const char * end = p + file.size();
+
+            // read the sections
+            bool has_format = false;
+            while (true) {
+                // skip the white space between sections
+                while (p != end && std::isspace(static_cast<unsigned char>(*p))) {
+                    ++p;
+                }
+                if (p == end) {
+                    break;
+                }
+                if (*p != '$') {
+                    throw std::runtime_error("gmsh: Mesh file could not be parsed");
+                }
+
+                // the name of the section (the data start on the next line)
+                auto name = _line(p, end).substr(1);
+
+                // the cursor on the data of the section
+                cursor_t cursor { p, end, _binary };
+
+                // read the section
+                if (name == "MeshFormat") {
+                    _format(p, end);
+                    has_format = true;
+                    continue;
+                } else if (!has_format) {
+                    throw std::runtime_error("gmsh: Mesh file has no format section");
+                } else if (name == "PhysicalNames") {
+                    _physical_names(p, end);
+                    continue;
+                } else if (name == "Entities") {
+                    _read_entities(cursor);
+                } else if (name == "Nodes") {
+                    _read_nodes(cursor);
+                } else if (name == "Elements") {
+                    _read_elements(cursor);
+                } else {
+                    // skip the sections that do not affect the mesh
+                    _skip(p, end, name);
+                    continue;
+                }
+
+                // check the end of the section
+                p = cursor.p;
+                _skip(p, end, name);
+            }
+
+            // an empty file is not a gmsh file
+            if (!has_format) {
+                throw std::runtime_error("gmsh: Mesh file has no format section");
+            }
+        }
+
+        // destructor
+        inline ~MshFile() = default;
+
+        // move constructor
+        inline MshFile(MshFile &&) noexcept = default;
+
+      private:
+        // delete copy constructor
+        MshFile(const MshFile &) = delete;
+
+        // delete assignment operator
+        MshFile & operator=(const MshFile &) = delete;
+
+        // delete move assignment operator
+        MshFile & operator=(MshFile &&) noexcept = delete;
+
+      private:
+        // the line starting at {p} (without the line break), moving {p} to the next line
+        static inline auto _line(const char *& p, const char * end) -> std::string_view
+        {
+            // find the end of the line
+            auto next = std::find(p, end, '\n');
+            std::string_view line(p, next - p);
+            if (!line.empty() && line.back() == '\r') {
+                line.remove_suffix(1);
+            }
+
+            // move past the line break
+            p = next == end ? end : next + 1;
+
+            // all done
+            return line;
+        }
+
+        // move {p} past the line closing section {name}
+        static inline auto _skip(const char *& p, const char * end, std::string_view name) -> void
+        {
+            // the closing line
+            auto closing = "$End" + std::string(name);
+
+            // search for the closing line (the data of the section may be binary)
+            std::string_view text(p, end - p);
+            auto position = text.find(closing);
+            if (position == std::string_view::npos) {
+                throw std::runtime_error("gmsh: Mesh file has an unterminated section");
+            }
+
+            // move past the closing line
+            p += position;
+            _line(p, end);
+
+            // all done
+            return;
+        }
+
+        // read the format of the file
+        inline auto _format(const char *& p, const char * end) -> void
+        {
+            // the version, the file type (0 for ASCII, 1 for binary) and the size of the sizes
+            auto version = summit::parseNumber<double>(p, end);
+            auto type = summit::parseNumber<int>(p, end);
+            auto data_size = summit::parseNumber<int>(p, end);
+            _line(p, end);
+            if (version < 4.1 || version >= 5.0) {
+                throw std::runtime_error("gmsh: Mesh file version is not supported (need 4.1)");
+            }
+            if (data_size != sizeof(std::uint64_t)) {
+                throw std::runtime_error("gmsh: Mesh file data size is not supported");
+            }
+            _binary = (type == 1);
+
+            // binary files carry the integer 1 to detect a mismatch of the byte order
+            if (_binary) {
+                cursor_t cursor { p, end, true };
+                if (cursor.read<std::int32_t>() != 1) {
+                    throw std::runtime_error("gmsh: Mesh file has a different byte order");
+                }
+                p = cursor.p;
+            }
+
+            // move past the closing line
+            _skip(p, end, "MeshFormat");
+
+            // all done
+            return;
+        }
+
+        // read the names of the physical groups (always as text)
+        inline auto _physical_names(const char *& p, const char * end) -> void
+        {
+            // the number of names
+            auto n_names = summit::parseNumber<int>(p, end);
+            _line(p, end);
+
+            // read each name, given as {dim tag "name"}
+            for (int i = 0; i < n_names; ++i) {
+                auto dim = summit::parseNumber<int>(p, end);
+                auto tag = summit::parseNumber<int>(p, end);
+                auto line = _line(p, end);
+                auto first = line.find('"');
+                auto last = line.rfind('"');
+                if (first == std::string_view::npos || last == first) {
+                    throw std::runtime_error("gmsh: Mesh file has an invalid physical name");
+                }
+                _names[{ dim, tag }] = std::string(line.substr(first + 1, last - first - 1));
+            }
+
+            // move past the closing line
+            _skip(p, end, "PhysicalNames");
+
+            // all done
+            return;
+        }
+
+        // read the first physical tag of each entity
+        inline auto _read_entities(cursor_t & cursor) -> void
+        {
+            // the number of points, curves, surfaces and volumes
+            std::array<std::uint64_t, 4> counts;
+            cursor.read(counts.data(), 4);
+
+            // read the entities of each dimension
+            for (int dim = 0; dim < 4; ++dim) {
+                for (std::uint64_t i = 0; i < counts[dim]; ++i) {
+                    // the tag of the entity
+                    auto tag = cursor.read<std::int32_t>();
+
+                    // skip the position of a point or the bounding box of the other entities
+                    std::array<double, 6> box;
+                    cursor.read(box.data(), dim == 0 ? 3 : 6);
+
+                    // the physical tags of the entity (keep the first)
+                    auto n_physical = cursor.read<std::uint64_t>();
+                    int physical = 0;
+                    for (std::uint64_t k = 0; k < n_physical; ++k) {
+                        auto value = cursor.read<std::int32_t>();
+                        if (k == 0) {
+                            physical = value;
+                        }
+                    }
+                    _entities[{ dim, tag }] = physical;
+
+                    // skip the bounding entities
+                    if (dim > 0) {
+                        auto n_bounding = cursor.read<std::uint64_t>();
+                        for (std::uint64_t k = 0; k < n_bounding; ++k) {
+                            cursor.read<std::int32_t>();
+                        }
+                    }
+                }
+            }
+
+            // all done
+            return;
+        }
+
+        // read the coordinates of the nodes
+        inline auto _read_nodes(cursor_t & cursor) -> void
+        {
+            // the number of blocks and of nodes, and the range of the node tags
+            std::array<std::uint64_t, 4> header;
+            cursor.read(header.data(), 4);
+            auto [n_blocks, n_nodes, min_tag, max_tag] = header;
+
+            // make room for the nodes
+            _first_tag = min_tag;
+            _numbers.assign(n_nodes > 0 ? max_tag - min_tag + 1 : 0, -1);
+            _coordinates.resize(3 * n_nodes);
+
+            // read the blocks
+            std::uint64_t count = 0;
+            std::vector<std::uint64_t> tags;
+            for (std::uint64_t block = 0; block < n_blocks; ++block) {
+                // the dimension of the entity, its tag, whether parametric coordinates follow, and
+                // the number of nodes in the block
+                auto dim = cursor.read<std::int32_t>();
+                cursor.read<std::int32_t>();
+                auto parametric = cursor.read<std::int32_t>();
+                auto n = cursor.read<std::uint64_t>();
+                if (count + n > n_nodes) {
+                    throw std::runtime_error("gmsh: Mesh file has an invalid node block");
+                }
+
+                // number the nodes in the order they appear
+                tags.resize(n);
+                cursor.read(tags.data(), n);
+                for (std::uint64_t i = 0; i < n; ++i) {
+                    if (tags[i] < min_tag || tags[i] > max_tag) {
+                        throw std::runtime_error("gmsh: Mesh file has an invalid node tag");
+                    }
+                    _numbers[tags[i] - min_tag] = count + i;
+                }
+
+                // read the coordinates (in bulk, unless parametric coordinates are interleaved)
+                if (!parametric) {
+                    cursor.read(_coordinates.data() + 3 * count, 3 * n);
+                } else {
+                    std::array<double, 3> uvw;
+                    for (std::uint64_t i = 0; i < n; ++i) {
+                        cursor.read(_coordinates.data() + 3 * (count + i), 3);
+                        cursor.read(uvw.data(), dim);
+                    }
+                }
+                count += n;
+            }
+
+            // all done
+            return;
+        }
+
+        // read the elements of the supported types
+        inline auto _read_elements(cursor_t & cursor) -> void
+        {
+            // the number of blocks and of elements, and the range of the element tags
+            std::array<std::uint64_t, 4> header;
+            cursor.read(header.data(), 4);
+            auto n_blocks = header[0];
+
+            // read the blocks
+            std::vector<std::uint64_t> data;
+            for (std::uint64_t block = 0; block < n_blocks; ++block) {
+                // the dimension and the tag of the entity, the type of the elements and their
+                // number
+                auto dim = cursor.read<std::int32_t>();
+                auto entity = cursor.read<std::int32_t>();
+                auto type = cursor.read<std::int32_t>();
+                auto n = cursor.read<std::uint64_t>();
+                if (dim < 0 || dim > 3 || element_dimension(type) != dim) {
+                    throw std::runtime_error("gmsh: Unsupported element type");
+                }
+
+                // read the tags and the nodes of the elements in bulk
+                int n_vertices = dim + 1;
+                data.resize((n_vertices + 1) * n);
+                cursor.read(data.data(), std::size(data));
+
+                // the physical tag of the entity
+                auto physical = _entities.find({ dim, entity });
+                int tag = physical == std::end(_entities) ? 0 : physical->second;
+
+                // collect the numbers of the nodes of the elements
+                auto & elements = _elements[dim];
+                elements.tags.insert(std::end(elements.tags), n, tag);
+                for (std::uint64_t e = 0; e < n; ++e) {
+                    for (int a = 0; a < n_vertices; ++a) {
+                        elements.connectivity.push_back(
+                            _number(data[(n_vertices + 1) * e + 1 + a]));
+                    }
+                }
+            }
+
+            // all done
+            return;
+        }
+
+        // the number of the node with tag {tag}
+        inline auto _number(std::uint64_t tag) const -> std::int32_t
+        {
+            // look up the node
+            auto index = tag - _first_tag;
+            if (tag < _first_tag || index >= std::size(_numbers) || _numbers[index] < 0) {
+                throw std::runtime_error("gmsh: Mesh file has invalid connectivity");
+            }
+
+            // all done
+            return _numbers[index];
+        }
+
+      public:
+        // whether the file is binary
+        inline auto binary() const noexcept -> bool { return _binary; }
+
+        // the number of nodes
+        inline auto n_nodes() const noexcept -> int { return std::size(_coordinates) / 3; }
+
+        // the coordinates of the nodes, 3 per node
+        inline auto coordinates() const noexcept -> std::span<const double>
+        {
+            return _coordinates;
+        }
+
+        // the elements of dimension {dim}
+        inline auto elements(int dim) const -> const elements_t & { return _elements.at(dim); }
+
+        // the names of the physical groups of dimension {dim}
+        inline auto names(int dim) const -> std::map<int, std::string>
+        {
+            // collect the names
+            std::map<int, std::string> names;
+            for (const auto & [key, name] : _names) {
+                if (key.first == dim) {
+                    names.emplace(key.second, name);
+                }
+            }
+
+            // all done
+            return names;
+        }
+
+      private:
+        // whether the file is binary
+        bool _binary;
+        // the coordinates of the nodes
+        std::vector<double> _coordinates;
+        // the elements of each dimension
+        std::array<elements_t, 4> _elements;
+        // the names of the physical groups, by dimension and tag
+        std::map<std::pair<int, int>, std::string> _names;
+        // the first physical tag of each entity, by dimension and tag
+        std::map<std::pair<int, int>, int> _entities;
+        // the number of each node, by tag (offset by the first tag)
+        std::vector<std::int32_t> _numbers;
+        // the first node tag
+        std::uint64_t _first_tag;
+    };
+}
+
+
+// end of file
@@ -0,0 +1,35 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::gmsh {
+
+    // a mesh of cells of type {cellT} read from a gmsh file, with each cell tagged with its
+    // physical tag, together with the physical groups of cells of one dimension less (e.g. the
+    // parts of the boundary where constraints are applied), sharing their nodes with the mesh
+    template <class cellT>
+    struct PhysicalMesh {
+        // the mesh type
+        using mesh_type = mesh::mesh_t<cellT>;
+        // the type of a physical group of cells of one dimension less (a cloud of nodes, for a
+        // mesh of segments)
+        using group_type = typename mesh::boundary_mesh<cellT>::type;
+
+        // the mesh
+        mesh_type mesh;
+        // the physical groups of cells of one dimension less, by physical tag
+        std::map<int, group_type> groups;
+        // the names of the physical groups of the cells, by physical tag
+        std::map<int, std::string> names;
+        // the names of the physical groups of cells of one dimension less, by physical tag
+        std::map<int, std::string> group_names;
+    };
+}
+
+
+// end of file
@@ -0,0 +1,21 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::gmsh {
+
+    // gmsh mesh file alias
+    using msh_file_t = MshFile;
+
+    // mesh with physical groups alias
+    template <class cellT>
+    using physical_mesh_t = PhysicalMesh<cellT>;
+}
+
+
+// end of file
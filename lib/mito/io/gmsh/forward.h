@@ -0,0 +1,21 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::gmsh {
+
+    // class for the contents of a mesh file in gmsh format
+    class MshFile;
+
+    // class for a mesh together with its physical groups
+    template <class cellT>
+    struct PhysicalMesh;
+}
+
+
+// end of file
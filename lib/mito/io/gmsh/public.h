@@ -0,0 +1,27 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+// external packages
+#include "externals.h"
+
+// get the forward declarations
+#include "forward.h"
+
+// classes implementation
+#include "MshFile.h"
+#include "PhysicalMesh.h"
+
+// published type factories; this is the file you are looking for...
+#include "api.h"
+
+// read functions
+#include "reader.h"
+
+
+// end of file
@@ -0,0 +1,126 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::gmsh {
+
+    // build the mesh of the cells of type {cellT} in {file}, with each cell tagged with its
+    // physical tag, together with the physical groups of cells of one dimension less
+    template <
+        class cellT, summit::GalerkinMeshType galerkinT = summit::CG,
+        geometry::coordinates_c coordT>
+    auto physical_reader(
+        const msh_file_t & file, geometry::coordinate_system_t<coordT> & coordinate_system)
+        -> physical_mesh_t<cellT>
+    requires(utilities::same_dim_c<cellT, coordT>)
+    {
+        // the dimension of the physical space
+        constexpr int D = cellT::dim;
+
+        // the order of the cells (i.e. the dimension of the gmsh elements)
+        constexpr int order = cellT::order;
+
+        // make a channel
+        journal::info_t channel("mito.gmsh.mesh_reader");
+
+        // report
+        channel << "Loading gmsh mesh..." << journal::endl;
+
+        // the cells and the elements of one dimension less
+        const auto & cells = file.elements(order);
+        const auto & faces = file.elements(order - 1);
+
+        // the number of each node of the file used by the mesh or by its physical groups
+        std::vector<std::int32_t> numbers(file.n_nodes(), -1);
+        std::vector<double> coordinates;
+
+        // helper function to renumber the nodes in {connectivity} in order of first appearance,
+        // collecting the coordinates of the new nodes
+        auto _renumber = [&file, &numbers, &coordinates](std::vector<std::int32_t> & connectivity) {
+            for (auto & node : connectivity) {
+                if (numbers[node] < 0) {
+                    numbers[node] = std::size(coordinates) / D;
+                    for (int d = 0; d < D; ++d) {
+                        coordinates.push_back(file.coordinates()[3 * node + d]);
+                    }
+                }
+                node = numbers[node];
+            }
+        };
+
+        // the connectivity of the cells
+        auto connectivity = cells.connectivity;
+        _renumber(connectivity);
+
+        // the connectivity and the physical tags of the elements of one dimension less belonging
+        // to a physical group
+        std::vector<std::int32_t> group_connectivity;
+        std::vector<int> group_tags;
+        for (int e = 0; e < std::ssize(faces.tags); ++e) {
+            if (faces.tags[e] != 0) {
+                group_tags.push_back(faces.tags[e]);
+                group_connectivity.insert(
+                    std::end(group_connectivity), std::begin(faces.connectivity) + order * e,
+                    std::begin(faces.connectivity) + order * (e + 1));
+            }
+        }
+        _renumber(group_connectivity);
+
+        // instantiate the nodes
+        auto nodes = binary::nodes<D>(coordinates, coordinate_system);
+
+        // the mesh, tagged with the physical tags of the cells
+        physical_mesh_t<cellT> result {
+            mesh::mesh<cellT>(), {}, file.names(order), file.names(order - 1)
+        };
+        binary::insert<galerkinT>(result.mesh, nodes, connectivity, cells.tags);
+
+        // the physical groups, sharing the nodes of the mesh
+        for (int e = 0; e < std::ssize(group_tags); ++e) {
+            auto & group = result.groups[group_tags[e]];
+            if constexpr (order == 1) {
+                // the physical groups of a mesh of segments are clouds of nodes
+                group.insert(nodes[group_connectivity[e]]);
+            } else {
+                binary::insert(
+                    group, nodes, std::span(group_connectivity).subspan(order * e, order));
+            }
+        }
+
+        // all done
+        return result;
+    }
+
+    // build the mesh of the cells of type {cellT} in file {filename}, with its physical groups
+    template <
+        class cellT, summit::GalerkinMeshType galerkinT = summit::CG,
+        geometry::coordinates_c coordT>
+    auto physical_reader(
+        const std::string & filename, geometry::coordinate_system_t<coordT> & coordinate_system)
+        -> physical_mesh_t<cellT>
+    requires(utilities::same_dim_c<cellT, coordT>)
+    {
+        return physical_reader<cellT, galerkinT>(msh_file_t(filename), coordinate_system);
+    }
+
+    // build the mesh of the cells of type {cellT} in file {filename}, with each cell tagged with
+    // its physical tag
+    template <
+        class cellT, summit::GalerkinMeshType galerkinT = summit::CG,
+        geometry::coordinates_c coordT>
+    auto reader(
+        const std::string & filename, geometry::coordinate_system_t<coordT> & coordinate_system)
+        -> mesh::mesh_t<cellT>
+    requires(utilities::same_dim_c<cellT, coordT>)
+    {
+        return std::move(physical_reader<cellT, galerkinT>(filename, coordinate_system).mesh);
+    }
+}
+
+
+// end of file
@@ -11,10 +11,17 @@
 #include "externals.h"
 
 // classes implementation
+#include "OutputThread.h"
 #include "Writer.h"
+#include "utilities.h"
 
 // classes implementation
 #include "summit/public.h"
+#include "binary/public.h"
+#include "vtu/public.h"
+#include "xdmf/public.h"
+#include "checkpoint/public.h"
+#include "gmsh/public.h"
 #ifdef WITH_VTK
 #include "vtk/public.h"
 #endif    // WITH_VTK
@@ -23,12 +23,15 @@ namespace mito::io {
         using coord_system_type = coordSystemT;
         // the dimension of the physical space
         static constexpr int D = mesh_type::dim;
-        // the type of point
-        using point_type = typename coord_system_type::point_type;
-        // the type of a collection of points (points are mapped to indices; points that are shared
-        // among multiple elements have the same index)
-        using points_type =
-            std::unordered_map<point_type, int, utilities::hash_function<point_type>>;
+        // the number of nodes per cell
+        static constexpr int N = cell_type::n_vertices;
+        // the type of a numbering of the points of the mesh (points that are shared among multiple
+        // elements have the same number)
+        using numbering_type = mesh::numbering_t<mesh_type>;
+        // the number of lines formatted by each task
+        static constexpr int chunk_size = 1 << 12;
+        // the number of lines formatted before writing them to file
+        static constexpr int batch_size = 1 << 18;
 
       public:
         // constructor
@@ -38,76 +41,163 @@ namespace mito::io {
             Writer(filename),
             _mesh(mesh),
             _coord_system(coord_system),
-            _points(),
+            _numbering(mesh::point_numbering(mesh)),
             _element_type(element_type)
+        {}
+
+        // destructor
+        ~MeshSummitWriter() = default;
+
+      private:
+        // append the number {value} to {buffer}, followed by {separator}
+        template <class T>
+        static inline auto _append(std::string & buffer, T value, char separator) -> void
         {
-            // index assigned to each point (start counting from 1, summit mesh convention)
-            auto index = 1;
-
-            // insert the points corresponding to the mesh nodes (eliminating duplicates)
-            for (const auto & cell : mesh.cells()) {
-                for (const auto & node : cell.nodes()) {
-                    const auto & point = node->point();
-                    auto [_, inserted] = _points.insert({ point, index });
-                    // if the point was inserted in the map (i.e. if it is not a duplicate)
-                    if (inserted) {
-                        // increment index
-                        ++index;
-                    }
+            // format the number (floating point numbers with 15 significant digits)
+            std::array<char, 32> digits;
+            auto [end, _] = [&digits, value]() {
+                if constexpr (std::is_floating_point_v<T>) {
+                    return std::to_chars(
+                        digits.data(), digits.data() + std::size(digits), value,
+                        std::chars_format::general, 15);
+                } else {
+                    return std::to_chars(digits.data(), digits.data() + std::size(digits), value);
+                }
+            }();
+
+            // append it
+            buffer.append(digits.data(), end);
+            buffer.push_back(separator);
+
+            // all done
+            return;
+        }
+
+        // write lines {0, ..., n_lines - 1} to {outfile}, formatting each line {line} with
+        // {format(line, buffer)} (batches of lines are formatted in parallel chunks, and written
+        // in order)
+        template <class formatT>
+        static inline auto _write_lines(std::ofstream & outfile, int n_lines, formatT && format)
+            -> void
+        {
+            // one buffer per chunk of a batch (reused across batches)
+            std::vector<std::string> buffers(batch_size / chunk_size);
+
+            // loop on the batches
+            for (int batch = 0; batch < n_lines; batch += batch_size) {
+                // the number of lines and of chunks in this batch
+                int n_batch_lines = std::min(batch_size, n_lines - batch);
+                int n_chunks = (n_batch_lines + chunk_size - 1) / chunk_size;
+
+                // format the chunks in parallel
+                utilities::parallel_for(
+                    0, n_chunks,
+                    [&](int chunk_begin, int chunk_end) {
+                        for (int chunk = chunk_begin; chunk < chunk_end; ++chunk) {
+                            auto & buffer = buffers[chunk];
+                            buffer.clear();
+                            int begin = batch + chunk * chunk_size;
+                            int end = std::min(begin + chunk_size, batch + n_batch_lines);
+                            for (int line = begin; line < end; ++line) {
+                                format(line, buffer);
+                            }
+                        }
+                    },
+                    1);
+
+                // write the chunks in order
+                for (int chunk = 0; chunk < n_chunks; ++chunk) {
+                    outfile.write(buffers[chunk].data(), std::size(buffers[chunk]));
                 }
             }
+
+            // all done
+            return;
         }
 
-        // destructor
-        ~MeshSummitWriter() = default;
+      protected:
+        // a job writing the mesh to file from a snapshot of the coordinates of its points and of
+        // its connectivity
+        auto _snapshot() const -> std::function<void()> override
+        {
+            // copy the coordinates of the points in the order of their numbers
+            std::vector<double> coordinates(D * _numbering.size());
+            utilities::parallel_for(0, _numbering.size(), [this, &coordinates](int begin, int end) {
+                for (int n = begin; n < end; ++n) {
+                    const auto & coord = _coord_system.coordinates(_numbering.node(n)->point());
+                    for (int d = 0; d < D; ++d) {
+                        coordinates[D * n + d] = coord[d];
+                    }
+                }
+            });
 
-      public:
-        // write mesh to file
-        virtual auto write() const -> void override
+            // the job
+            return [filename = this->_filename + ".summit", coordinates = std::move(coordinates),
+                    connectivity = _numbering.connectivity(), element_type = _element_type]() {
+                _write(filename, coordinates, connectivity, element_type);
+            };
+        }
+
+      private:
+        // write the mesh with the points at {coordinates} and the cells with nodes {connectivity}
+        // to {filename}
+        static auto _write(
+            const std::string & filename, const std::vector<double> & coordinates,
+            const std::vector<int> & connectivity, const std::string & element_type) -> void
         {
-            // assemble the file name
-            std::string filename = this->_filename + ".summit";
+            // the number of points and of cells
+            int n_points = std::size(coordinates) / D;
+            int n_cells = std::size(connectivity) / N;
 
             // create the output file
             std::ofstream outfile(filename);
 
             // populate the file heading
             // TOFIX: number of materials is always 1 for now
-            outfile << D << std::endl;
-            outfile << std::size(_points) << " " << _mesh.nCells() << " " << 1 << std::endl;
-
-            // a sorted vector with points (the vector subscript is the point index minus one)
-            std::vector<point_type> points_vector(std::size(_points));
-            for (const auto & [point, index] : _points) {
-                points_vector[index - 1] = point;
-            }
-
-            // write the points to file in an order determined by their index
-            for (const auto & point : points_vector) {
-                const auto & coord = _coord_system.coordinates(point);
-                outfile << std::setprecision(15);
-                for (int d = 0; d < D; ++d)
-                    outfile << coord[d] << " ";
-                outfile << std::endl;
-            }
+            outfile << D << "\n";
+            outfile << n_points << " " << n_cells << " " << 1 << "\n";
 
-            // write the cells to file
-            for (const auto & cell : _mesh.cells()) {
-                outfile << summit::cell<cell_type>::type << " ";
-                for (const auto & node : cell.nodes()) {
-                    outfile << _points.at(node->point()) << " ";
+            // write the points to file in the order of their numbers
+            _write_lines(outfile, n_points, [&coordinates](int n, std::string & buffer) {
+                for (int d = 0; d < D; ++d) {
+                    _append(buffer, coordinates[D * n + d], ' ');
                 }
-                // TOFIX: material label is always 1 for now
-                outfile << 1 << " " << _element_type << std::endl;
-            }
+                buffer.push_back('\n');
+            });
+
+            // write the cells to file (numbers start from 1, summit mesh convention)
+            _write_lines(
+                outfile, n_cells, [&connectivity, &element_type](int e, std::string & buffer) {
+                    _append(buffer, summit::cell<cell_type>::type, ' ');
+                    for (int a = 0; a < N; ++a) {
+                        _append(buffer, connectivity[N * e + a] + 1, ' ');
+                    }
+                    // TOFIX: material label is always 1 for now
+                    buffer.append("1 ");
+                    buffer.append(element_type);
+                    buffer.push_back('\n');
+                });
 
             // close the file
             outfile.close();
 
+            // check that everything went well
+            if (!outfile) {
+                throw std::runtime_error("summit: File " + filename + " could not be written");
+            }
+
             // all done
             return;
         }
 
+      public:
+        // write mesh to file
+        virtual auto write() const -> void override
+        {
+            // write a snapshot of the mesh right away
+            return _snapshot()();
+        }
+
       private:
         // a const reference to the mesh
         const mesh_type & _mesh;
@@ -115,8 +205,8 @@ namespace mito::io {
         // a const reference to the coordinate system
         const coord_system_type & _coord_system;
 
-        // a collection of points in the mesh
-        points_type _points;
+        // the numbering of the points in the mesh
+        numbering_type _numbering;
 
         // the type of element
         std::string _element_type;
@@ -0,0 +1,217 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::summit {
+
+    // read from {fileStream} the bytes from offset {begin} to offset {end}, preceded by the byte
+    // before {begin} and followed by the rest of the line running past {end} (if any), so that
+    // the lines starting in the range are whole and can be told apart from the line in progress
+    inline auto readRange(std::ifstream & fileStream, std::size_t begin, std::size_t end)
+        -> std::string
+    {
+        // read the range, with the byte before it
+        std::string text(end - begin + 1, '\0');
+        fileStream.seekg(begin - 1);
+        fileStream.read(text.data(), std::size(text));
+
+        // read on up to the end of the last line
+        constexpr std::size_t piece = 4096;
+        while (!std::empty(text) && text.back() != '\n' && fileStream) {
+            auto size = std::size(text);
+            text.resize(size + piece);
+            fileStream.read(text.data() + size, piece);
+            text.resize(size + fileStream.gcount());
+            auto newline = text.find('\n', size);
+            if (newline != std::string::npos) {
+                text.resize(newline + 1);
+            }
+        }
+
+        // all done
+        return text;
+    }
+
+    // read the contiguous block of cells of this task of the summit mesh in {filename}, with one
+    // block per task in {communicator}
+    // The file is split in byte ranges of equal size, one per task: each task reads and parses
+    // only the lines starting in its own range, numbers them by counting the lines of the
+    // previous ranges, and sends the nodes and the cells it parsed to the tasks whose blocks they
+    // belong to; then each task fetches the coordinates of the nodes of its cells from the tasks
+    // holding them
+    template <class cellT>
+    auto block_reader(const std::string & filename, MPI_Comm communicator = MPI_COMM_WORLD)
+        -> mesh::distributed::block_t<cellT>
+    {
+        // the dimension of the physical space
+        constexpr int D = cellT::dim;
+        // the number of nodes per cell
+        constexpr int V = cellT::n_vertices;
+
+        // the type of global ids
+        using global_id_t = mesh::distributed::global_id_t;
+
+        // the id of this task and the number of tasks
+        int task_id = 0;
+        int n_tasks = 0;
+        MPI_Comm_rank(communicator, &task_id);
+        MPI_Comm_size(communicator, &n_tasks);
+
+        // open the file
+        std::ifstream fileStream(filename, std::ios::binary);
+        if (!fileStream.is_open()) {
+            throw std::runtime_error("reader: Mesh file could not be opened");
+        }
+
+        // read the heading
+        int dim = 0;
+        global_id_t n_nodes = 0;
+        global_id_t n_cells = 0;
+        int n_cell_types = 0;
+        fileStream >> dim >> n_nodes >> n_cells >> n_cell_types;
+        fileStream.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+        // assert this mesh object is of same dimension of the mesh being read
+        assert(D == dim);
+
+        // the range of the lines following the heading
+        std::size_t body = fileStream.tellg();
+        fileStream.seekg(0, std::ios::end);
+        std::size_t size = fileStream.tellg();
+
+        // the byte range of this task
+        auto range_begin = body + ((size - body) * task_id) / n_tasks;
+        auto range_end = body + ((size - body) * (task_id + 1)) / n_tasks;
+
+        // read the range, and find the (non-blank) lines starting in it (the first byte is the
+        // one before the range, which never starts a line of this task)
+        auto text = readRange(fileStream, range_begin, range_end);
+        auto lines = findLines(text, 0);
+        if (!std::empty(lines) && lines.front() == 0) {
+            lines.erase(std::begin(lines));
+        }
+
+        // the number of the first line of this task, and the total number of lines
+        global_id_t n_lines = std::size(lines);
+        global_id_t first_line = 0;
+        global_id_t total_lines = 0;
+        MPI_Exscan(&n_lines, &first_line, 1, MPI_INT64_T, MPI_SUM, communicator);
+        MPI_Allreduce(&n_lines, &total_lines, 1, MPI_INT64_T, MPI_SUM, communicator);
+        if (task_id == 0) {
+            first_line = 0;
+        }
+        if (total_lines < n_nodes + n_cells) {
+            throw std::runtime_error("reader: Mesh file ended unexpectedly");
+        }
+
+        // parse the lines: the nodes come first, then the cells
+        const char * last = text.data() + std::size(text);
+        std::vector<double> coordinates;
+        std::vector<int> node_destinations;
+        std::vector<global_id_t> cells;
+        std::vector<int> cell_destinations;
+        for (global_id_t k = 0; k < n_lines; ++k) {
+            // the global number of the line and its text
+            auto line = first_line + k;
+            const char * p = text.data() + lines[k];
+
+            // a node: read its coordinates
+            if (line < n_nodes) {
+                for (int d = 0; d < D; ++d) {
+                    coordinates.push_back(parseNumber<double>(p, last));
+                }
+                node_destinations.push_back(
+                    mesh::distributed::block_owner(line, n_nodes, n_tasks));
+                continue;
+            }
+
+            // a cell: read its type and skip cells of other types
+            auto e = line - n_nodes;
+            if (e >= n_cells || parseNumber<int>(p, last) != summit::cell<cellT>::type) {
+                continue;
+            }
+
+            // read the connectivity (the summit format starts counting from one)
+            cells.push_back(e);
+            for (int a = 0; a < V; ++a) {
+                cells.push_back(parseNumber<global_id_t>(p, last) - 1);
+            }
+            cell_destinations.push_back(mesh::distributed::block_owner(e, n_cells, n_tasks));
+        }
+
+        // send the nodes and the cells to the tasks of their blocks (the items received from each
+        // task, in order of rank, are in order of global id, so that the received nodes are the
+        // contiguous block of nodes of this task, and the received cells are in ascending order)
+        auto node_coordinates =
+            mesh::distributed::send(coordinates, D, node_destinations, communicator).first;
+        auto received =
+            mesh::distributed::send(cells, V + 1, cell_destinations, communicator).first;
+
+        // sanity check: this task received its block of nodes
+        assert(
+            std::ssize(node_coordinates)
+            == D
+                   * (mesh::distributed::block_begin(n_nodes, task_id + 1, n_tasks)
+                      - mesh::distributed::block_begin(n_nodes, task_id, n_tasks)));
+
+        // unpack the cells of the block
+        mesh::distributed::block_t<cellT> block;
+        block.n_cells = n_cells;
+        block.cells.reserve(std::size(received) / (V + 1));
+        block.connectivity.reserve(V * (std::size(received) / (V + 1)));
+        for (std::size_t i = 0; i < std::size(received); i += V + 1) {
+            block.cells.push_back(received[i]);
+            block.connectivity.insert(
+                std::end(block.connectivity), std::begin(received) + i + 1,
+                std::begin(received) + i + V + 1);
+        }
+
+        // the nodes referenced by the cells of the block (sorted, without repetitions)
+        auto nodes = block.connectivity;
+        std::sort(std::begin(nodes), std::end(nodes));
+        nodes.erase(std::unique(std::begin(nodes), std::end(nodes)), std::end(nodes));
+
+        // fetch their coordinates
+        auto node_values =
+            mesh::distributed::fetch(nodes, n_nodes, node_coordinates, D, communicator);
+
+        // store the coordinates of the nodes of each cell
+        block.coordinates.reserve(D * std::size(block.connectivity));
+        for (auto id : block.connectivity) {
+            auto n = std::lower_bound(std::begin(nodes), std::end(nodes), id) - std::begin(nodes);
+            for (int d = 0; d < D; ++d) {
+                block.coordinates.push_back(node_values[D * n + d]);
+            }
+        }
+
+        // all done
+        return block;
+    }
+
+    // read the summit mesh in {filename} by contiguous blocks of cells, one per task in
+    // {communicator}, partition it and send each cell to the task of its partition, so that no
+    // task ever holds the whole mesh
+    template <class cellT, geometry::coordinates_c coordT>
+    requires(utilities::same_dim_c<cellT, coordT>)
+    auto distributed_reader(
+        const std::string & filename, geometry::coordinate_system_t<coordT> & coordinate_system,
+        MPI_Comm communicator = MPI_COMM_WORLD) -> mesh::distributed::partition_t<cellT>
+    {
+        // read the block of cells of this task
+        auto block = block_reader<cellT>(filename, communicator);
+
+        // partition the cells
+        auto painting = mesh::distributed::paint(block, communicator);
+
+        // send the cells to their partition
+        return mesh::distributed::migrate(block, painting, coordinate_system, communicator);
+    }
+}
+
+
+// end of file
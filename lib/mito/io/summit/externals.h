@@ -8,7 +8,16 @@
 
 
 // externals
+#include <algorithm>
+#include <array>
+#include <charconv>
 #include <fstream>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 
 // end of file
@@ -21,5 +21,9 @@
 #include "reader.h"
 #include "writer.h"
 
+#ifdef WITH_MPI
+#include "distributed_reader.h"
+#endif
+
 
 // end of file
@@ -8,119 +8,166 @@
 
 
 namespace mito::io::summit {
-    template <int D, geometry::coordinates_c coordT>
-    requires(coordT::dim == D)
-    auto readVertices(
-        std::ifstream & fileStream, geometry::coordinate_system_t<coordT> & coordinate_system,
-        int N_vertices, std::vector<geometry::node_t<D>> & nodes) -> void
-    {
-        // fill in nodes
-        for (int n = 0; n < N_vertices; ++n) {
-            // instantiate new point
-            tensor::vector_t<D> coordinates;
-            for (int d = 0; d < D; ++d) {
-                // read point coordinates
-                fileStream >> coordinates[d];
-            }
 
-            // the type of coordinates
-            using coordinates_type = coordT;
+    // the size in bytes of the blocks a summit file is split into to find its lines in parallel
+    constexpr std::size_t block_size = 1 << 20;
 
-            // instantiate a new node
-            auto node = mito::geometry::node(coordinate_system, coordinates_type(coordinates));
-
-            // add node to {nodes}
-            nodes.push_back(node);
+    // skip the blanks starting at {p} (but not past {end})
+    inline auto skipBlanks(const char * p, const char * end) -> const char *
+    {
+        while (p != end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+            ++p;
         }
 
         // all done
-        return;
+        return p;
     }
 
-    template <GalerkinMeshType galerkinT, geometry::geometric_simplex_c cellT>
-    auto readElement(
-        std::ifstream & fileStream, mesh::mesh_t<cellT> & mesh,
-        const std::vector<geometry::node_t<cellT::dim>> & nodes) -> void
+    // parse a number of type {T} starting at {p} (but not past {end}) and advance {p} past it
+    template <class T>
+    inline auto parseNumber(const char *& p, const char * end) -> T
     {
-        // get the number of vertices
-        constexpr int N = cellT::n_vertices;
+        // skip the leading white space and plus sign
+        while (p != end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) {
+            ++p;
+        }
+        if (p != end && *p == '+') {
+            ++p;
+        }
 
-        // the element connectivity
-        std::array<int, N> index;
-        // for each node
-        for (int i = 0; i < N; ++i) {
-            // read from file the id of the node
-            int id = 0;
-            fileStream >> id;
-            // start from zero (the summit format starts counting from one)
-            --id;
-            // take a note of it
-            index[i] = id;
+        // parse the number
+        T value {};
+        auto [next, error] = std::from_chars(p, end, value);
+        if (error != std::errc()) {
+            throw std::runtime_error("reader: Mesh file could not be parsed");
         }
+        p = next;
 
-        // if it is a continuous Galerkin mesh
-        if constexpr (galerkinT == CG) {
+        // all done
+        return value;
+    }
 
-            // helper function to call the mesh insert method with {N} nodes
-            constexpr auto _insert = []<size_t... I>(
-                                         mesh::mesh_t<cellT> & mesh, const std::array<int, N> index,
-                                         const std::vector<geometry::node_t<cellT::dim>> & nodes,
-                                         std::index_sequence<I...>) {
-                // insert in the mesh a geometric simplex with these nodes
-                mesh.insert({ nodes[index[I]]... });
-            };
+    // read in bulk the rest of the file in {fileStream}
+    inline auto readText(std::ifstream & fileStream) -> std::string
+    {
+        // the size of the rest of the file
+        auto begin = fileStream.tellg();
+        fileStream.seekg(0, std::ios::end);
+        auto end = fileStream.tellg();
+        fileStream.seekg(begin);
 
-            // insert the nodes in the mesh
-            _insert(mesh, index, nodes, std::make_index_sequence<N>{});
+        // read it in one go
+        std::string text(end - begin, '\0');
+        fileStream.read(text.data(), std::size(text));
 
-        }
-        // otherwise
-        else {
-            // assert that it is then a discontinuous Galerkin mesh
-            static_assert(galerkinT == DG);
+        // all done
+        return text;
+    }
 
-            // helper function to call the mesh insert method with {N} nodes
-            constexpr auto _insert = []<size_t... I>(
-                                         mesh::mesh_t<cellT> & mesh, const std::array<int, N> index,
-                                         const std::vector<geometry::node_t<cellT::dim>> & nodes,
-                                         std::index_sequence<I...>) {
-                // insert in the mesh a geometric simplex with a new instance of the nodes riding on
-                // same vertex and same point
-                mesh.insert({ geometry::node_t<cellT::dim>(
-                    nodes[index[I]]->vertex(), nodes[index[I]]->point())... });
-            };
-
-            // insert the nodes in the mesh
-            _insert(mesh, index, nodes, std::make_index_sequence<N>{});
+    // the offsets in {text} of the lines that start at or after offset {begin} and are not blank,
+    // found by scanning blocks of {text} in parallel
+    inline auto findLines(const std::string & text, std::size_t begin) -> std::vector<std::size_t>
+    {
+        // the number of blocks
+        int n_blocks = (std::size(text) - begin + block_size - 1) / block_size;
+
+        // the lines starting in each block
+        std::vector<std::vector<std::size_t>> lines(n_blocks);
+        utilities::parallel_for(
+            0, n_blocks,
+            [&text, &lines, begin](int block_begin, int block_end) {
+                for (int block = block_begin; block < block_end; ++block) {
+                    // the range of the block
+                    auto first = begin + block * block_size;
+                    auto last = std::min(first + block_size, std::size(text));
+                    // collect the lines starting in the block that are not blank
+                    for (auto offset = first; offset < last; ++offset) {
+                        if (offset != begin && text[offset - 1] != '\n') {
+                            continue;
+                        }
+                        auto p = skipBlanks(text.data() + offset, text.data() + std::size(text));
+                        if (p != text.data() + std::size(text) && *p != '\n') {
+                            lines[block].push_back(offset);
+                        }
+                    }
+                }
+            },
+            1);
+
+        // concatenate the lines of all the blocks
+        std::vector<std::size_t> result;
+        for (const auto & block : lines) {
+            result.insert(std::end(result), std::begin(block), std::end(block));
         }
 
-        // QUESTION: Can the label be more than one?
-        // read label for cell
-        // TOFIX: Ignored for now
-        std::string cell_set_id;
-        fileStream >> cell_set_id;
+        // all done
+        return result;
+    }
+
+    // parse in parallel the {D} coordinates of the nodes, one node per line in {lines}
+    template <int D>
+    auto readVertices(
+        const std::string & text, std::span<const std::size_t> lines,
+        std::vector<double> & coordinates) -> void
+    {
+        // make room for the coordinates
+        coordinates.resize(D * std::size(lines));
+
+        // parse the lines
+        utilities::parallel_for(0, std::size(lines), [&](int begin, int end) {
+            for (int n = begin; n < end; ++n) {
+                const char * p = text.data() + lines[n];
+                for (int d = 0; d < D; ++d) {
+                    coordinates[D * n + d] = parseNumber<double>(p, text.data() + std::size(text));
+                }
+            }
+        });
 
         // all done
         return;
     }
 
-    template <GalerkinMeshType galerkinT, class cellT>
+    // parse in parallel the cells of type {cellT}, one cell per line in {lines}, collecting the
+    // (0-based) indices of their nodes, their cell set ids and whether each line holds a cell of
+    // type {cellT} (lines with cells of other types are skipped)
+    template <class cellT>
     auto readElements(
-        std::ifstream & fileStream, mesh::mesh_t<cellT> & mesh, int N_cells,
-        const std::vector<geometry::node_t<cellT::dim>> & nodes) -> void
+        const std::string & text, std::span<const std::size_t> lines,
+        std::vector<int> & connectivity, std::vector<int> & tags, std::vector<char> & selected)
+        -> void
     {
-        // for each element
-        for (int i = 0; i < N_cells; ++i) {
-            // read the cell type from file
-            int cell_type = 0;
-            fileStream >> cell_type;
-
-            // if the cell type read from file matches with the cell of the mesh to be populated
-            if (cell_type == summit::cell<cellT>::type) {
-                // read the element and insert it in the mesh
-                readElement<galerkinT>(fileStream, mesh, nodes);
+        // get the number of vertices
+        constexpr int N = cellT::n_vertices;
+
+        // make room for the cells
+        connectivity.resize(N * std::size(lines));
+        tags.resize(std::size(lines));
+        selected.resize(std::size(lines));
+
+        // parse the lines
+        utilities::parallel_for(0, std::size(lines), [&](int begin, int end) {
+            // the end of the text
+            const char * last = text.data() + std::size(text);
+            for (int e = begin; e < end; ++e) {
+                const char * p = text.data() + lines[e];
+
+                // read the cell type and skip cells of other types
+                selected[e] = (parseNumber<int>(p, last) == summit::cell<cellT>::type);
+                if (!selected[e]) {
+                    continue;
+                }
+
+                // read the ids of the nodes (the summit format starts counting from one)
+                for (int a = 0; a < N; ++a) {
+                    connectivity[N * e + a] = parseNumber<int>(p, last) - 1;
+                }
+
+                // read the cell set id (0, if missing or not numeric)
+                tags[e] = 0;
+                p = skipBlanks(p, last);
+                std::from_chars(p, last, tags[e]);
             }
-        }
+        });
 
         // all done
         return;
@@ -142,9 +189,13 @@ namespace mito::io::summit {
         // report
         channel << "Loading summit mesh..." << journal::endl;
 
+        // read the file in bulk
+        auto text = readText(fileStream);
+        const char * p = text.data();
+        const char * end = text.data() + std::size(text);
+
         // read dimension of physical space
-        int dim = 0;
-        fileStream >> dim;
+        int dim = parseNumber<int>(p, end);
 
         // the dimension of the physical space
         constexpr int D = cellT::dim;
@@ -152,36 +203,102 @@ namespace mito::io::summit {
         // assert this mesh object is of same dimension of the mesh being read
         assert(D == dim);
 
-        // instantiate mesh
-        auto mesh = mesh::mesh<cellT>();
-
         // read number of vertices
-        int N_vertices = 0;
-        fileStream >> N_vertices;
-        // reserve space for nodes
-        std::vector<geometry::node_t<D>> nodes;
-        nodes.reserve(N_vertices);
+        int N_vertices = parseNumber<int>(p, end);
 
         // read number of cells
-        int N_cells = 0;
-        fileStream >> N_cells;
+        int N_cells = parseNumber<int>(p, end);
 
         // read number of cell types
-        int N_cell_types = 0;
-        fileStream >> N_cell_types;
+        int N_cell_types = parseNumber<int>(p, end);
 
         // QUESTION: Not sure that we need this...
         assert(N_cell_types == 1);
 
-        // read the nodes
-        readVertices(fileStream, coordinate_system, N_vertices, nodes);
+        // find the lines of the vertices and of the cells, following the heading
+        auto lines = findLines(text, std::find(p, end, '\n') - text.data());
+        if (std::ssize(lines) < N_vertices + N_cells) {
+            throw std::runtime_error("reader: Mesh file ended unexpectedly");
+        }
+        auto vertex_lines = std::span(lines).subspan(0, N_vertices);
+        auto cell_lines = std::span(lines).subspan(N_vertices, N_cells);
+
+        // parse the coordinates of the vertices and the cells
+        std::vector<double> coordinates;
+        readVertices<D>(text, vertex_lines, coordinates);
+        std::vector<int> connectivity;
+        std::vector<int> tags;
+        std::vector<char> selected;
+        readElements<cellT>(text, cell_lines, connectivity, tags, selected);
+
+        // instantiate the nodes
+        std::vector<geometry::node_t<D>> nodes;
+        nodes.reserve(N_vertices);
+        for (int n = 0; n < N_vertices; ++n) {
+            // the coordinates of the node
+            tensor::vector_t<D> x;
+            for (int d = 0; d < D; ++d) {
+                x[d] = coordinates[D * n + d];
+            }
+
+            // instantiate a new node
+            nodes.push_back(mito::geometry::node(coordinate_system, coordT(x)));
+        }
+
+        // instantiate mesh (with all the cells in a single memory segment)
+        auto mesh = mesh::mesh<cellT>(std::max(1, N_cells));
+
+        // get the number of vertices
+        constexpr int N = cellT::n_vertices;
+
+        // keep only the cells of the selected type (with their tags)
+        int n_selected = 0;
+        for (int e = 0; e < N_cells; ++e) {
+            if (selected[e]) {
+                std::copy_n(&connectivity[N * e], N, &connectivity[N * n_selected]);
+                tags[n_selected] = tags[e];
+                ++n_selected;
+            }
+        }
+        connectivity.resize(N * n_selected);
+        tags.resize(n_selected);
 
-        // read the cells
-        readElements<galerkinT>(fileStream, mesh, N_cells, nodes);
+        // if it is a continuous Galerkin mesh
+        if constexpr (galerkinT == CG) {
+            // insert in the mesh the geometric simplices with these nodes, storing the cell set id
+            // of each cell as its tag
+            mesh.insert(nodes, connectivity, tags);
+        }
+        // otherwise
+        else {
+            // assert that it is then a discontinuous Galerkin mesh
+            static_assert(galerkinT == DG);
 
-        // sanity check: the number of nodes in the map is N_vertices
-        nodes.shrink_to_fit();
-        assert(std::size(nodes) == static_cast<size_t>(N_vertices));
+            // make room for the tags of the cells
+            mesh.reserve_tags(n_selected);
+
+            // insert the cells
+            for (int e = 0; e < n_selected; ++e) {
+                // helper function to fetch the {a}-th node of the {e}-th cell
+                auto _node = [&nodes, &connectivity, N_vertices, e](int a) -> const auto & {
+                    auto index = connectivity[N * e + a];
+                    if (index < 0 || index >= N_vertices) {
+                        throw std::runtime_error("reader: Mesh file has invalid connectivity");
+                    }
+                    return nodes[index];
+                };
+
+                // insert in the mesh a geometric simplex with a new instance of the nodes riding
+                // on same vertex and same point
+                auto & cell = [&]<int... a>(std::integer_sequence<int, a...>) -> auto & {
+                    return mesh.insert(
+                        { geometry::node_t<D>(_node(a)->vertex(), _node(a)->point())... });
+                }(std::make_integer_sequence<int, N>{});
+
+                // store the cell set id as the tag of the cell
+                mesh.tag(cell, tags[e]);
+            }
+        }
 
         // sanity check: the number of cells of highest dimension in the map is N_cells
         assert(mesh.nCells() == N_cells);
@@ -22,6 +22,21 @@ namespace mito::io::summit {
         return mesh_writer.write();
     }
 
+    // write the mesh in the background: the coordinates of its points are copied right away, and
+    // the mesh is formatted and written to file on the output thread
+    template <class cellT, geometry::coordinates_c coordT>
+    requires(utilities::same_dim_c<cellT, coordT>)
+    auto async_writer(
+        std::string filename, const mito::mesh::mesh_t<cellT> & mesh,
+        const geometry::coordinate_system_t<coordT> & coordinate_system,
+        std::string element_type = "") -> std::shared_future<void>
+    {
+        // create a writer
+        auto mesh_writer = mesh_writer_t(filename, mesh, coordinate_system, element_type);
+        // write in the background
+        return mesh_writer.write_async();
+    }
+
 }    // namespace mito::io::summit
 
 
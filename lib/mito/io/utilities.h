@@ -0,0 +1,42 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io {
+
+    // concept of a value type made of {n_components<Y>()} doubles stored contiguously (i.e. a
+    // double or a tensor of doubles with no other data)
+    template <class Y>
+    concept flat_doubles_c =
+        std::is_same_v<Y, double>
+        || (requires { typename Y::scalar_type; } && std::is_same_v<typename Y::scalar_type, double>
+            && sizeof(Y) == Y::size * sizeof(double));
+
+    // the number of components of a value of type {Y}
+    template <class Y>
+    constexpr auto n_components() -> int
+    {
+        if constexpr (std::is_arithmetic_v<Y>) {
+            return 1;
+        } else {
+            return Y::size;
+        }
+    }
+
+    // view the {values} as the contiguous doubles of their components
+    template <class Y>
+    requires(flat_doubles_c<std::remove_const_t<Y>>)
+    auto flat_values(std::span<Y> values) -> std::span<const double>
+    {
+        return { reinterpret_cast<const double *>(values.data()),
+                 n_components<std::remove_const_t<Y>>() * std::size(values) };
+    }
+}
+
+
+// end of file
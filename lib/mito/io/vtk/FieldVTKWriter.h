@@ -77,12 +77,16 @@ namespace mito::io::vtk {
       public:
         FieldVTKWriter(
             std::string filename, const grid_type & grid, const coord_system_type & coord_system) :
-            _grid_writer(filename, grid, coord_system)
+            _grid_writer(filename, grid, coord_system),
+            _checked_index(),
+            _index_matches(false)
         {}
 
       private:
-        template <class Y>
-        auto _attach_field(const field_type<Y> & field, std::string fieldname) -> void
+        // attach to the grid a copy of the values of {field}, a field with values of type {Y} keyed
+        // by the nodes or the points of the grid
+        template <class Y, class fieldT>
+        auto _attach_field(const fieldT & field, std::string fieldname) -> void
         {
             // get the grid
             auto & grid = _grid_writer.grid();
@@ -129,6 +133,34 @@ namespace mito::io::vtk {
             return;
         }
 
+        // whether the dense {field} is numbered like the points of the grid
+        // The check is done once per index: the fields sharing the index of the last field checked
+        // are numbered the same way
+        template <class fieldT>
+        auto _numbered_like_grid(const fieldT & field) -> bool
+        {
+            // reuse the outcome of the last check, if the field shares its index
+            if (_checked_index == field.shared_index()) {
+                return _index_matches;
+            }
+
+            // get the nodes in the grid
+            const auto & nodes = _grid_writer.nodes();
+
+            // check that the {index}-th value of the field is the value at the {index}-th point
+            bool matches = (std::ssize(nodes) == field.size());
+            for (auto node = std::begin(nodes); matches && node != std::end(nodes); ++node) {
+                matches = (field.index().key(node->second) == node->first);
+            }
+
+            // remember the outcome (keeping the index alive, so that its address is not reused)
+            _checked_index = field.shared_index();
+            _index_matches = matches;
+
+            // all done
+            return matches;
+        }
+
       public:
         // sign {field} up for writing
         template <class Y>
@@ -141,7 +173,65 @@ namespace mito::io::vtk {
             }
 
             // delegate to the grid
-            return _attach_field(field, fieldname);
+            return _attach_field<Y>(field, fieldname);
+        }
+
+        // sign the dense {field} up for writing
+        // Fields of doubles (or of tensors of doubles) on a mesh or a function space that are
+        // numbered like the points of the grid (e.g. built by {dense_mesh_field}) are wrapped in
+        // place, without copies or lookups, so they must outlive the writes of the grid; other
+        // fields are copied
+        template <class Y>
+        auto record(
+            const discrete::dense_field_t<typename field_type<Y>::input_type, Y> & field,
+            std::string fieldname = "") -> void
+        {
+            // if no name was provided
+            if (fieldname == "") {
+                // use the name of the field
+                fieldname = field.name();
+            }
+
+            // wrap the values in place, if possible
+            if constexpr (
+                flat_doubles_c<Y>
+                && (mesh::mesh_c<grid_type> or fem::function_space_c<grid_type>)) {
+                if (_numbered_like_grid(field)) {
+                    return record(flat_values(field.values()), dim<Y>(), fieldname);
+                }
+            }
+
+            // otherwise, copy them
+            return _attach_field<Y>(field, fieldname);
+        }
+
+        // sign up for writing the field with {values} stored contiguously in the order of the
+        // points of the grid (i.e. of the numbering of the nodes, for a mesh), {n_components} per
+        // point
+        // The vtk array wraps the values in place, without copies or lookups, so they must outlive
+        // the writes of the grid
+        auto record(std::span<const double> values, int n_components, std::string fieldname)
+            -> void
+        {
+            // get the grid
+            auto & grid = _grid_writer.grid();
+
+            // check the size of the array
+            if (std::ssize(values) != n_components * grid->GetNumberOfPoints()) {
+                throw std::runtime_error("vtk: Point data " + fieldname + " has wrong size");
+            }
+
+            // wrap the values in a vtk array (which does not own them, and only reads them)
+            auto vtkArray = vtkSmartPointer<vtkDoubleArray>::New();
+            vtkArray->SetName(fieldname.data());
+            vtkArray->SetNumberOfComponents(n_components);
+            vtkArray->SetArray(const_cast<double *>(values.data()), std::size(values), 1);
+
+            // insert array into output grid
+            grid->GetPointData()->AddArray(vtkArray);
+
+            // all done
+            return;
         }
 
         // write the grid with the attached fields
@@ -151,9 +241,30 @@ namespace mito::io::vtk {
             return _grid_writer.write();
         }
 
+        // write the grid with the current values of the attached fields in the background (the
+        // fields can be recorded again for the next step right away)
+        auto write_async() -> std::shared_future<void>
+        {
+            // delegate to the grid
+            return _grid_writer.write_async();
+        }
+
+        // wait for the pending background writes
+        auto wait() -> void
+        {
+            // delegate to the grid
+            return _grid_writer.wait();
+        }
+
       protected:
         // the grid writer
         grid_writer_type _grid_writer;
+
+      private:
+        // the index of the last dense field checked against the points of the grid
+        std::shared_ptr<const void> _checked_index;
+        // whether the fields with that index are numbered like the points of the grid
+        bool _index_matches;
     };
 
 }    // namespace mito::io::vtk
@@ -25,19 +25,20 @@ namespace mito::io::vtk {
         // (protected so this class cannot be instantiated unless by the derived classes)
         GridVTKWriter(std::string filename) : Writer(filename), _grid(vtk_grid_type::New()) {}
 
-      public:
-        auto write() const -> void override
+      private:
+        // write {grid} to the vtu file {filename}
+        static auto _write(const vtk_grid_type & grid, const std::string & filename) -> void
         {
             // create a new writer
             auto writer = vtkSmartPointer<vtkXMLUnstructuredGridWriter>::New();
             // set the name of the output file
-            writer->SetFileName((this->_filename + ".vtu").data());
+            writer->SetFileName(filename.data());
 
             // sign the grid up for writing
 #if VTK_MAJOR_VERSION <= 8
-            writer->SetInput(_grid);
+            writer->SetInput(grid);
 #else
-            writer->SetInputData(_grid);
+            writer->SetInputData(grid);
 #endif
             // write the grid to file
             writer->Write();
@@ -46,6 +47,25 @@ namespace mito::io::vtk {
             return;
         }
 
+      protected:
+        // a job writing a deep copy of the grid (with the fields attached to it) to file
+        auto _snapshot() const -> std::function<void()> override
+        {
+            // copy the grid
+            auto grid = vtk_grid_type::New();
+            grid->DeepCopy(_grid);
+
+            // the job
+            return [grid, filename = this->_filename + ".vtu"]() { _write(grid, filename); };
+        }
+
+      public:
+        auto write() const -> void override
+        {
+            // write the grid to file
+            return _write(_grid, this->_filename + ".vtu");
+        }
+
         // accessor for the grid
         auto grid() -> vtk_grid_type & { return _grid; }
 
@@ -0,0 +1,165 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::vtu {
+
+    template <class gridWriterT>
+    class FieldVTUWriter {
+
+      private:
+        // the grid writer type
+        using grid_writer_type = gridWriterT;
+        // the grid type
+        using grid_type = typename grid_writer_type::grid_type;
+        // the field type
+        template <class Y>
+        using field_type = discrete::mesh_field_t<grid_type::dim, Y>;
+
+      public:
+        template <geometry::coordinate_system_c coordSystemT>
+        FieldVTUWriter(
+            std::string filename, const grid_type & grid, const coordSystemT & coord_system,
+            EncodingType encoding = RAW) :
+            _grid_writer(filename, grid, coord_system, encoding),
+            _checked_index(),
+            _index_matches(false)
+        {}
+
+      private:
+        // attach to the grid a copy of the values of {field}, a field with values of type {Y} keyed
+        // by the nodes of the grid
+        template <class Y, class fieldT>
+        auto _attach_field(const fieldT & field, std::string fieldname) -> void
+        {
+            // the number of components of the field
+            constexpr int n_components = io::n_components<Y>();
+
+            // collect the values of the field at the points of the grid
+            const auto & numbering = _grid_writer.numbering();
+            std::vector<double> values(n_components * numbering.size());
+            for (int n = 0; n < numbering.size(); ++n) {
+                const auto & value = field(numbering.node(n));
+                if constexpr (std::is_arithmetic_v<Y>) {
+                    values[n] = value;
+                } else {
+                    std::copy(
+                        std::begin(value), std::end(value),
+                        std::begin(values) + n_components * n);
+                }
+            }
+
+            // attach the values to the grid
+            return _grid_writer.add_point_data(fieldname, n_components, std::move(values));
+        }
+
+        // whether the dense {field} is numbered like the points of the grid
+        // The check is done once per index: the fields sharing the index of the last field checked
+        // are numbered the same way
+        template <class fieldT>
+        auto _numbered_like_grid(const fieldT & field) -> bool
+        {
+            // reuse the outcome of the last check, if the field shares its index
+            if (_checked_index == field.shared_index()) {
+                return _index_matches;
+            }
+
+            // get the numbering of the points of the grid
+            const auto & numbering = _grid_writer.numbering();
+
+            // check that the {n}-th value of the field is the value at the {n}-th point
+            bool matches = (numbering.size() == field.size());
+            for (int n = 0; matches && n < numbering.size(); ++n) {
+                matches = (field.index().key(n) == numbering.node(n));
+            }
+
+            // remember the outcome (keeping the index alive, so that its address is not reused)
+            _checked_index = field.shared_index();
+            _index_matches = matches;
+
+            // all done
+            return matches;
+        }
+
+      public:
+        // accessor for the numbering of the points of the grid
+        auto numbering() const -> const auto & { return _grid_writer.numbering(); }
+
+        // sign {field} up for writing
+        template <class Y>
+        auto record(const field_type<Y> & field, std::string fieldname = "") -> void
+        {
+            // if no name was provided
+            if (fieldname == "") {
+                // use the name of the field
+                fieldname = field.name();
+            }
+
+            // attach a copy of the values of the field to the grid
+            return _attach_field<Y>(field, fieldname);
+        }
+
+        // sign the dense {field} up for writing
+        // Fields of doubles (or of tensors of doubles) numbered like the points of the grid (e.g.
+        // built by {dense_mesh_field}) are written in place, without copies or lookups, so they
+        // must outlive the writes of the grid; other fields are copied
+        template <class Y>
+        auto record(
+            const discrete::dense_mesh_field_t<grid_type::dim, Y> & field,
+            std::string fieldname = "") -> void
+        {
+            // if no name was provided
+            if (fieldname == "") {
+                // use the name of the field
+                fieldname = field.name();
+            }
+
+            // write the values in place, if possible
+            if constexpr (flat_doubles_c<Y>) {
+                if (_numbered_like_grid(field)) {
+                    return record(flat_values(field.values()), n_components<Y>(), fieldname);
+                }
+            }
+
+            // otherwise, copy them
+            return _attach_field<Y>(field, fieldname);
+        }
+
+        // sign up for writing the field with {values} stored contiguously in the order of the
+        // numbering of the points of the grid, {n_components} per point
+        // The values are written in place, without copies or lookups, so they must outlive the
+        // writes of the grid
+        auto record(std::span<const double> values, int n_components, std::string fieldname)
+            -> void
+        {
+            // attach a view of the values to the grid
+            return _grid_writer.add_point_data(fieldname, n_components, values);
+        }
+
+        // write the grid with the attached fields
+        auto write() const -> void
+        {
+            // delegate to the grid
+            return _grid_writer.write();
+        }
+
+      protected:
+        // the grid writer
+        grid_writer_type _grid_writer;
+
+      private:
+        // the index of the last dense field checked against the points of the grid
+        std::shared_ptr<const void> _checked_index;
+        // whether the fields with that index are numbered like the points of the grid
+        bool _index_matches;
+    };
+
+}    // namespace mito::io::vtu
+
+
+// end of file
@@ -0,0 +1,286 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::vtu {
+
+    // a writer of an unstructured grid to a vtu file in binary appended format, streamed straight
+    // from the grid arrays (raw, or compressed with zlib in independent blocks)
+    class GridVTUWriter : public Writer {
+
+      protected:
+        // the size in bytes of the blocks compressed independently
+        static constexpr std::size_t block_size = 1 << 15;
+
+        // a named array of values attached to the points of the grid
+        struct data_array_t {
+            // the name of the array
+            std::string name;
+            // the number of components per point
+            int n_components;
+            // the values, {n_components} per point (viewed in place, if empty)
+            std::vector<double> storage;
+            // a view of the values, either in {storage} or in the storage of the caller
+            std::span<const double> values;
+        };
+
+        // an array of the appended data section, ready to be written
+        struct encoded_array_t {
+            // the header of the array (byte counts)
+            std::vector<std::uint64_t> header;
+            // the compressed blocks (if compressed)
+            std::vector<std::vector<unsigned char>> blocks;
+            // the raw bytes (if not compressed)
+            std::span<const std::byte> raw;
+
+            // the size in bytes of the encoded array
+            auto size() const -> std::size_t
+            {
+                auto size = header.size() * sizeof(std::uint64_t) + raw.size();
+                for (const auto & block : blocks) {
+                    size += std::size(block);
+                }
+                return size;
+            }
+        };
+
+      protected:
+        // constructor
+        // (protected so this class cannot be instantiated unless by the derived classes)
+        GridVTUWriter(std::string filename, EncodingType encoding) :
+            Writer(filename),
+            _encoding(encoding),
+            _points(),
+            _connectivity(),
+            _n_vertices(0),
+            _cell_type(0),
+            _point_data()
+        {
+#ifndef WITH_ZLIB
+            // compression needs zlib
+            if (encoding == ZLIB) {
+                throw std::runtime_error("vtu: Compression requires zlib support (WITH_ZLIB)");
+            }
+#endif    // WITH_ZLIB
+        }
+
+      private:
+        // encode the {bytes} of an array
+        auto _encode(std::span<const std::byte> bytes) const -> encoded_array_t
+        {
+            // the encoded array
+            encoded_array_t array;
+
+            // raw data is preceded by its size in bytes
+            if (_encoding == RAW) {
+                array.header = { bytes.size() };
+                array.raw = bytes;
+                return array;
+            }
+
+#ifdef WITH_ZLIB
+            // compressed data is split in blocks, and preceded by the number of blocks, the size
+            // of a block, the size of the last block and the compressed size of each block
+            int n_blocks = (bytes.size() + block_size - 1) / block_size;
+            array.header = { static_cast<std::uint64_t>(n_blocks), block_size,
+                             n_blocks > 0 ? bytes.size() - (n_blocks - 1) * block_size : 0 };
+            array.blocks.resize(n_blocks);
+
+            // compress the blocks in parallel
+            utilities::parallel_for(
+                0, n_blocks,
+                [&bytes, &array](int begin, int end) {
+                    for (int b = begin; b < end; ++b) {
+                        auto block = bytes.subspan(
+                            b * block_size, std::min(block_size, bytes.size() - b * block_size));
+                        auto size = ::compressBound(block.size());
+                        array.blocks[b].resize(size);
+                        if (::compress2(
+                                array.blocks[b].data(), &size,
+                                reinterpret_cast<const Bytef *>(block.data()), block.size(),
+                                Z_DEFAULT_COMPRESSION)
+                            != Z_OK) {
+                            throw std::runtime_error("vtu: Data could not be compressed");
+                        }
+                        array.blocks[b].resize(size);
+                    }
+                },
+                16);
+
+            // record the compressed sizes
+            for (const auto & block : array.blocks) {
+                array.header.push_back(std::size(block));
+            }
+#endif    // WITH_ZLIB
+
+            // all done
+            return array;
+        }
+
+        // write {array} to {outfile}
+        static auto _write(std::ofstream & outfile, const encoded_array_t & array) -> void
+        {
+            outfile.write(
+                reinterpret_cast<const char *>(array.header.data()),
+                array.header.size() * sizeof(std::uint64_t));
+            outfile.write(reinterpret_cast<const char *>(array.raw.data()), array.raw.size());
+            for (const auto & block : array.blocks) {
+                outfile.write(reinterpret_cast<const char *>(block.data()), std::size(block));
+            }
+
+            // all done
+            return;
+        }
+
+      protected:
+        // write the grid to the vtu file {filename}
+        auto _write_piece(const std::string & filename) const -> void
+        {
+            // the number of points and of cells
+            auto n_points = std::size(_points) / 3;
+            auto n_cells = _n_vertices > 0 ? std::size(_connectivity) / _n_vertices : 0;
+
+            // the offsets of the end of each cell in the connectivity and the types of the cells
+            std::vector<std::int64_t> offsets(n_cells);
+            for (std::size_t e = 0; e < n_cells; ++e) {
+                offsets[e] = (e + 1) * _n_vertices;
+            }
+            std::vector<std::uint8_t> types(n_cells, _cell_type);
+
+            // encode the arrays, in the order they are appended
+            std::vector<encoded_array_t> arrays;
+            for (const auto & data : _point_data) {
+                arrays.push_back(_encode(std::as_bytes(data.values)));
+            }
+            arrays.push_back(_encode(std::as_bytes(std::span(_points))));
+            arrays.push_back(_encode(std::as_bytes(std::span(_connectivity))));
+            arrays.push_back(_encode(std::as_bytes(std::span(offsets))));
+            arrays.push_back(_encode(std::as_bytes(std::span(types))));
+
+            // the offsets of the arrays in the appended data section
+            std::vector<std::size_t> positions(std::size(arrays), 0);
+            for (std::size_t i = 1; i < std::size(arrays); ++i) {
+                positions[i] = positions[i - 1] + arrays[i - 1].size();
+            }
+
+            // helper function to describe the {i}-th array
+            int i = 0;
+            auto _data_array = [&positions, &i](
+                                   std::string type, std::string name, int n_components) {
+                return "<DataArray type=\"" + type + "\" Name=\"" + name
+                     + "\" NumberOfComponents=\"" + std::to_string(n_components)
+                     + "\" format=\"appended\" offset=\"" + std::to_string(positions[i++])
+                     + "\"/>\n";
+            };
+
+            // create the output file
+            std::ofstream outfile(filename, std::ios::binary);
+            if (!outfile.is_open()) {
+                throw std::runtime_error("vtu: File " + filename + " could not be created");
+            }
+
+            // write the description of the grid
+            outfile << "<?xml version=\"1.0\"?>\n"
+                    << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" "
+                    << "byte_order=\"" << _byte_order() << "\" header_type=\"UInt64\""
+                    << (_encoding == ZLIB ? " compressor=\"vtkZLibDataCompressor\"" : "")
+                    << ">\n<UnstructuredGrid>\n"
+                    << "<Piece NumberOfPoints=\"" << n_points << "\" NumberOfCells=\"" << n_cells
+                    << "\">\n<PointData>\n";
+            for (const auto & data : _point_data) {
+                outfile << _data_array("Float64", data.name, data.n_components);
+            }
+            outfile << "</PointData>\n<Points>\n"
+                    << _data_array("Float64", "Points", 3) << "</Points>\n<Cells>\n"
+                    << _data_array("Int64", "connectivity", 1)
+                    << _data_array("Int64", "offsets", 1) << _data_array("UInt8", "types", 1)
+                    << "</Cells>\n</Piece>\n</UnstructuredGrid>\n"
+                    << "<AppendedData encoding=\"raw\">\n_";
+
+            // write the arrays
+            for (const auto & array : arrays) {
+                _write(outfile, array);
+            }
+
+            // close the description
+            outfile << "\n</AppendedData>\n</VTKFile>\n";
+
+            // check that everything went well
+            if (!outfile) {
+                throw std::runtime_error("vtu: File " + filename + " could not be written");
+            }
+
+            // all done
+            return;
+        }
+
+        // the byte order of this machine, as named in vtk files
+        static auto _byte_order() -> std::string
+        {
+            return std::endian::native == std::endian::little ? "LittleEndian" : "BigEndian";
+        }
+
+      public:
+        // write the grid to file
+        auto write() const -> void override
+        {
+            // write the grid to a single vtu file
+            return _write_piece(this->_filename + ".vtu");
+        }
+
+        // attach the array {values} with {n_components} components per point named {name}
+        auto add_point_data(std::string name, int n_components, std::vector<double> values)
+            -> void
+        {
+            // attach a view of the array
+            add_point_data(name, n_components, std::span<const double>(values));
+
+            // keep the array (moving the vector keeps its buffer, so the view stays valid)
+            _point_data.back().storage = std::move(values);
+
+            // all done
+            return;
+        }
+
+        // attach the array {values} with {n_components} components per point named {name}
+        // without copying it: the values are written straight from the storage of the caller,
+        // which must outlive the writes of the grid
+        auto add_point_data(std::string name, int n_components, std::span<const double> values)
+            -> void
+        {
+            // check the size of the array
+            if (std::size(values) != n_components * std::size(_points) / 3) {
+                throw std::runtime_error("vtu: Point data " + name + " has wrong size");
+            }
+
+            // attach the view
+            _point_data.push_back({ name, n_components, {}, values });
+
+            // all done
+            return;
+        }
+
+      protected:
+        // the encoding of the appended data
+        EncodingType _encoding;
+        // the cartesian coordinates of the points, three per point
+        std::vector<double> _points;
+        // the indices of the points of the cells, {_n_vertices} per cell
+        std::vector<std::int64_t> _connectivity;
+        // the number of points per cell
+        int _n_vertices;
+        // the vtk type of the cells
+        std::uint8_t _cell_type;
+        // the arrays attached to the points
+        std::vector<data_array_t> _point_data;
+    };
+
+}    // namespace mito::io::vtu
+
+
+// end of file
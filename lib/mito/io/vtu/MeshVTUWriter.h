@@ -0,0 +1,61 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::vtu {
+
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT, class gridWriterT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    class MeshVTUWriter : public gridWriterT {
+      public:
+        // the grid type
+        using grid_type = meshT;
+        // the grid writer type
+        using grid_writer_type = gridWriterT;
+        // the type of a numbering of the nodes of the mesh (each node is a vtu point)
+        using numbering_type = mesh::numbering_t<grid_type>;
+
+      private:
+        // the coordinate system type
+        using coord_system_type = coordSystemT;
+        // the cell type
+        using cell_type = typename grid_type::cell_type;
+
+      public:
+        MeshVTUWriter(
+            std::string filename, const grid_type & mesh, const coord_system_type & coord_system,
+            EncodingType encoding = RAW) :
+            grid_writer_type(filename, encoding),
+            _numbering(mesh::node_numbering(mesh))
+        {
+            // the cells
+            this->_n_vertices = cell_type::n_vertices;
+            this->_cell_type = cell<cell_type>::type;
+            this->_connectivity.assign(
+                std::begin(_numbering.connectivity()), std::end(_numbering.connectivity()));
+
+            // the points, in the order of the numbering of the nodes
+            this->_points.resize(3 * _numbering.size());
+            for (int n = 0; n < _numbering.size(); ++n) {
+                auto point = vtu_point(coord_system.coordinates(_numbering.node(n)->point()));
+                std::copy(std::begin(point), std::end(point), std::begin(this->_points) + 3 * n);
+            }
+        }
+
+        // accessor for the numbering of the nodes
+        auto numbering() const -> const numbering_type & { return _numbering; }
+
+      private:
+        // the numbering of the nodes of the mesh
+        numbering_type _numbering;
+    };
+
+}    // namespace mito::io::vtu
+
+
+// end of file
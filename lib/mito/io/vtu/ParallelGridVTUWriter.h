@@ -0,0 +1,91 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::vtu {
+
+    // a writer of the pieces of a distributed grid to one vtu file per task, indexed by a pvtu
+    // file written by the first task
+    class ParallelGridVTUWriter : public GridVTUWriter {
+
+      protected:
+        // constructor
+        // (protected so this class cannot be instantiated unless by the derived classes)
+        ParallelGridVTUWriter(
+            std::string filename, EncodingType encoding, MPI_Comm communicator = MPI_COMM_WORLD) :
+            GridVTUWriter(filename, encoding),
+            _communicator(communicator)
+        {}
+
+      public:
+        auto write() const -> void override
+        {
+            // get the size of the job
+            int n_tasks = 0;
+            MPI_Comm_size(_communicator, &n_tasks);
+
+            // get my process' rank
+            int task_id = 0;
+            MPI_Comm_rank(_communicator, &task_id);
+
+            // write the piece of this task
+            this->_write_piece(this->_filename + "_" + std::to_string(task_id) + ".vtu");
+
+            // the first task writes the index of the pieces
+            if (task_id == 0) {
+                _write_index(n_tasks);
+            }
+
+            // all done
+            return;
+        }
+
+      private:
+        // write the pvtu file indexing the pieces of the {n_tasks} tasks
+        auto _write_index(int n_tasks) const -> void
+        {
+            // the name of the pieces, relative to the directory of the index
+            auto basename = this->_filename.substr(this->_filename.find_last_of('/') + 1);
+
+            // create the output file
+            auto filename = this->_filename + ".pvtu";
+            std::ofstream outfile(filename);
+            if (!outfile.is_open()) {
+                throw std::runtime_error("vtu: File " + filename + " could not be created");
+            }
+
+            // write the description of the distributed grid
+            outfile << "<?xml version=\"1.0\"?>\n"
+                    << "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\" "
+                    << "byte_order=\"" << this->_byte_order() << "\" header_type=\"UInt64\">\n"
+                    << "<PUnstructuredGrid GhostLevel=\"0\">\n<PPointData>\n";
+            for (const auto & data : this->_point_data) {
+                outfile << "<PDataArray type=\"Float64\" Name=\"" << data.name
+                        << "\" NumberOfComponents=\"" << data.n_components << "\"/>\n";
+            }
+            outfile << "</PPointData>\n<PPoints>\n"
+                    << "<PDataArray type=\"Float64\" Name=\"Points\" NumberOfComponents=\"3\"/>\n"
+                    << "</PPoints>\n";
+            for (int task = 0; task < n_tasks; ++task) {
+                outfile << "<Piece Source=\"" << basename << "_" << task << ".vtu\"/>\n";
+            }
+            outfile << "</PUnstructuredGrid>\n</VTKFile>\n";
+
+            // all done
+            return;
+        }
+
+      private:
+        // the communicator of the tasks holding the pieces
+        MPI_Comm _communicator;
+    };
+
+}    // namespace mito::io::vtu
+
+
+// end of file
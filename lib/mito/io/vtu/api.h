@@ -0,0 +1,58 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::vtu {
+
+    // mesh writer alias
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    using mesh_writer_t = MeshVTUWriter<meshT, coordSystemT, GridVTUWriter>;
+
+    // field writer alias
+    template <class gridWriterT>
+    using field_writer_t = FieldVTUWriter<gridWriterT>;
+
+    // vtu mesh writer factory
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    auto grid_writer(
+        std::string filename, const meshT & mesh, const coordSystemT & coord_system,
+        EncodingType encoding = RAW);
+
+    // vtu mesh field writer factory
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    auto field_writer(
+        std::string filename, const meshT & mesh, const coordSystemT & coord_system,
+        EncodingType encoding = RAW);
+
+#ifdef WITH_MPI
+    // parallel mesh writer alias
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    using parallel_mesh_writer_t = MeshVTUWriter<meshT, coordSystemT, ParallelGridVTUWriter>;
+
+    // parallel vtu mesh writer factory
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    auto parallel_grid_writer(
+        std::string filename, const meshT & mesh, const coordSystemT & coord_system,
+        EncodingType encoding = RAW);
+
+    // parallel vtu mesh field writer factory
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    auto parallel_field_writer(
+        std::string filename, const meshT & mesh, const coordSystemT & coord_system,
+        EncodingType encoding = RAW);
+#endif    // WITH_MPI
+}
+
+
+// end of file
@@ -0,0 +1,32 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+// externals
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#ifdef WITH_ZLIB
+#include <zlib.h>
+#endif    // WITH_ZLIB
+#ifdef WITH_MPI
+#include <mpi.h>
+#endif    // WITH_MPI
+
+// support
+#include "../../discrete.h"
+
+
+// end of file
@@ -0,0 +1,58 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::vtu {
+
+    // vtu mesh writer factory
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    auto grid_writer(
+        std::string filename, const meshT & mesh, const coordSystemT & coord_system,
+        EncodingType encoding)
+    {
+        return mesh_writer_t<meshT, coordSystemT>(filename, mesh, coord_system, encoding);
+    }
+
+    // vtu mesh field writer factory
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    auto field_writer(
+        std::string filename, const meshT & mesh, const coordSystemT & coord_system,
+        EncodingType encoding)
+    {
+        return field_writer_t<mesh_writer_t<meshT, coordSystemT>>(
+            filename, mesh, coord_system, encoding);
+    }
+
+#ifdef WITH_MPI
+    // parallel vtu mesh writer factory
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    auto parallel_grid_writer(
+        std::string filename, const meshT & mesh, const coordSystemT & coord_system,
+        EncodingType encoding)
+    {
+        return parallel_mesh_writer_t<meshT, coordSystemT>(filename, mesh, coord_system, encoding);
+    }
+
+    // parallel vtu mesh field writer factory
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    auto parallel_field_writer(
+        std::string filename, const meshT & mesh, const coordSystemT & coord_system,
+        EncodingType encoding)
+    {
+        return field_writer_t<parallel_mesh_writer_t<meshT, coordSystemT>>(
+            filename, mesh, coord_system, encoding);
+    }
+#endif    // WITH_MPI
+}
+
+
+// end of file
@@ -0,0 +1,35 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::vtu {
+
+    // the encoding of the data appended to a vtu file
+    enum EncodingType { RAW, ZLIB };
+
+    // class for the writer of a grid to a vtu file
+    class GridVTUWriter;
+
+#ifdef WITH_MPI
+    // class for the writer of the pieces of a distributed grid to vtu files, and of their
+    // index to a pvtu file
+    class ParallelGridVTUWriter;
+#endif    // WITH_MPI
+
+    // class for the writer of a mesh
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT, class gridWriterT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    class MeshVTUWriter;
+
+    // class for the writer of fields on a grid
+    template <class gridWriterT>
+    class FieldVTUWriter;
+}
+
+
+// end of file
@@ -0,0 +1,65 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::vtu {
+
+    // the vtk type of a geometric simplex
+    template <geometry::geometric_simplex_c cellT>
+    struct cell;
+
+    // specialization for a geometric segment (VTK_LINE)
+    template <geometry::geometric_segment_c cellT>
+    struct cell<cellT> {
+        static constexpr std::uint8_t type = 3;
+    };
+
+    // specialization for a geometric triangle (VTK_TRIANGLE)
+    template <geometry::geometric_triangle_c cellT>
+    struct cell<cellT> {
+        static constexpr std::uint8_t type = 5;
+    };
+
+    // specialization for a geometric tetrahedron (VTK_TETRA)
+    template <geometry::geometric_tetrahedron_c cellT>
+    struct cell<cellT> {
+        static constexpr std::uint8_t type = 10;
+    };
+
+    // the cartesian coordinates of a point with coordinates {coord}, padded to three components
+    template <geometry::coordinates_c coordT>
+    auto vtu_point(const coordT & coord) -> std::array<double, 3>
+    {
+        // the dimension of the physical space
+        constexpr int D = coordT::dim;
+
+        // the cartesian coordinates type
+        using cartesian_type = geometry::coordinates_t<D, geometry::CARTESIAN>;
+
+        // transform {coord} into cartesian coordinates, if needed
+        auto cartesian_coord = [&coord]() -> cartesian_type {
+            if constexpr (std::is_same_v<coordT, cartesian_type>) {
+                return coord;
+            } else {
+                return geometry::transform_coordinates<cartesian_type>(coord);
+            }
+        }();
+
+        // pad with zeros
+        std::array<double, 3> result = { 0.0, 0.0, 0.0 };
+        for (int d = 0; d < D; ++d) {
+            result[d] = cartesian_coord[d];
+        }
+
+        // all done
+        return result;
+    }
+}
+
+
+// end of file
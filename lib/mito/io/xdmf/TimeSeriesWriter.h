@@ -0,0 +1,312 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::xdmf {
+
+    // a writer of a time series of fields on a mesh, in xdmf format with the heavy data in a raw
+    // binary file: the geometry and the topology of the mesh are written once, and each step only
+    // appends the values of the recorded fields to the binary file and a light description of the
+    // step to the xdmf file (both files are kept open for the lifetime of the writer)
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    class TimeSeriesWriter {
+
+      public:
+        // the mesh type
+        using mesh_type = meshT;
+        // the coordinate system type
+        using coord_system_type = coordSystemT;
+        // the type of a numbering of the nodes of the mesh
+        using numbering_type = mesh::numbering_t<mesh_type>;
+
+      private:
+        // the cell type
+        using cell_type = typename mesh_type::cell_type;
+        // the number of nodes per cell
+        static constexpr int N = cell_type::n_vertices;
+        // the closing of the xdmf file
+        static constexpr const char * trailer = "</Grid>\n</Domain>\n</Xdmf>\n";
+
+        // a field recorded for output
+        struct record_t {
+            // the name of the field
+            std::string name;
+            // the number of components per entity
+            int n_components;
+            // whether the field lives on the nodes or on the cells
+            bool nodal;
+            // the current values of the field, sampled at the nodes of the numbering (in a buffer,
+            // if needed)
+            std::function<auto(const numbering_type &, std::vector<double> &)
+                              ->std::span<const double>>
+                sample;
+        };
+
+      public:
+        // constructor
+        TimeSeriesWriter(
+            std::string filename, const mesh_type & mesh, const coord_system_type & coord_system) :
+            _filename(filename),
+            _numbering(mesh::node_numbering(mesh)),
+            _n_cells(mesh.nCells()),
+            _data(filename + ".bin", std::ios::binary),
+            _xdmf(filename + ".xdmf"),
+            _position(0),
+            _trailer_position(0),
+            _geometry_position(0),
+            _topology_position(0),
+            _records(),
+            _buffer(),
+            _n_steps(0)
+        {
+            // check that the files could be created
+            if (!_data.is_open() || !_xdmf.is_open()) {
+                throw std::runtime_error("xdmf: Files " + filename + " could not be created");
+            }
+
+            // the coordinates of the nodes (cartesian, padded to three components)
+            std::vector<double> points(3 * _numbering.size());
+            for (int n = 0; n < _numbering.size(); ++n) {
+                auto point = vtu::vtu_point(coord_system.coordinates(_numbering.node(n)->point()));
+                std::copy(std::begin(point), std::end(point), std::begin(points) + 3 * n);
+            }
+            _geometry_position = _append(std::span<const double>(points));
+
+            // the connectivity of the cells
+            std::vector<std::int64_t> connectivity(
+                std::begin(_numbering.connectivity()), std::end(_numbering.connectivity()));
+            _topology_position = _append(std::span<const std::int64_t>(connectivity));
+
+            // make the geometry and the topology visible to readers
+            _data.flush();
+
+            // write the opening of the xdmf file
+            _xdmf << "<?xml version=\"1.0\" ?>\n"
+                  << "<Xdmf Version=\"3.0\">\n<Domain>\n"
+                  << "<Grid Name=\"" << _basename() << "\" GridType=\"Collection\" "
+                  << "CollectionType=\"Temporal\">\n";
+            _trailer_position = _xdmf.tellp();
+            _xdmf << trailer << std::flush;
+        }
+
+        // destructor
+        ~TimeSeriesWriter() = default;
+
+        // move constructor
+        TimeSeriesWriter(TimeSeriesWriter &&) = default;
+
+      private:
+        // delete copy constructor
+        TimeSeriesWriter(const TimeSeriesWriter &) = delete;
+
+        // delete assignment operator
+        TimeSeriesWriter & operator=(const TimeSeriesWriter &) = delete;
+
+        // delete move assignment operator
+        TimeSeriesWriter & operator=(TimeSeriesWriter &&) = delete;
+
+      private:
+        // the name of the files, relative to their directory
+        auto _basename() const -> std::string
+        {
+            return _filename.substr(_filename.find_last_of('/') + 1);
+        }
+
+        // append {values} to the binary file and return their position in it
+        template <class T>
+        auto _append(std::span<const T> values) -> std::int64_t
+        {
+            // write the values
+            _data.write(reinterpret_cast<const char *>(values.data()), values.size_bytes());
+
+            // update the position of the end of the file
+            auto position = _position;
+            _position += values.size_bytes();
+
+            // all done
+            return position;
+        }
+
+        // the description of {n_items} items of {n_components} components of type {type}
+        // ({Float} or {Int}) found at {position} in the binary file
+        auto _data_item(std::int64_t n_items, int n_components, std::string type,
+                        std::int64_t position) const -> std::string
+        {
+            return "<DataItem Dimensions=\"" + std::to_string(n_items) + " "
+                 + std::to_string(n_components) + "\" NumberType=\"" + type
+                 + "\" Precision=\"8\" Format=\"Binary\" Endian=\""
+                 + (std::endian::native == std::endian::little ? "Little" : "Big") + "\" Seek=\""
+                 + std::to_string(position) + "\">" + _basename() + ".bin</DataItem>\n";
+        }
+
+        // the shortest representation of {time} that reads back exactly
+        static auto _time(double time) -> std::string
+        {
+            std::array<char, 32> buffer;
+            auto end = std::to_chars(buffer.data(), buffer.data() + buffer.size(), time).ptr;
+            return std::string(buffer.data(), end);
+        }
+
+        // the xdmf type of an attribute with {n_components} components
+        static auto _attribute_type(int n_components) -> std::string
+        {
+            switch (n_components) {
+                case 1:
+                    return "Scalar";
+                case 3:
+                    return "Vector";
+                case 6:
+                    return "Tensor6";
+                case 9:
+                    return "Tensor";
+                default:
+                    return "Matrix";
+            }
+        }
+
+      public:
+        // sign the mesh field {field} up for output at each step (the field is sampled at each
+        // step, so it must outlive the writer)
+        template <class Y>
+        auto record(const discrete::mesh_field_t<mesh_type::dim, Y> & field, std::string name = "")
+            -> void
+        {
+            // the number of components of the field
+            constexpr int n_components = io::n_components<Y>();
+
+            // sample the field at the nodes, in the order of their numbers
+            auto sample = [&field](const numbering_type & numbering, std::vector<double> & buffer)
+                -> std::span<const double> {
+                buffer.resize(n_components * numbering.size());
+                for (int n = 0; n < numbering.size(); ++n) {
+                    const auto & value = field(numbering.node(n));
+                    if constexpr (std::is_arithmetic_v<Y>) {
+                        buffer[n] = value;
+                    } else {
+                        std::copy(
+                            std::begin(value), std::end(value),
+                            std::begin(buffer) + n_components * n);
+                    }
+                }
+                return buffer;
+            };
+
+            // record the field
+            _records.push_back({ name == "" ? field.name() : name, n_components, true, sample });
+
+            // all done
+            return;
+        }
+
+        // sign the cell values {values}, {n_components} per cell in the order of iteration on the
+        // cells, up for output at each step (the values are read at each step, so they must
+        // outlive the writer)
+        auto record(const std::vector<double> & values, int n_components, std::string name)
+            -> void
+        {
+            // check the size of the values
+            if (std::ssize(values) != n_components * _n_cells) {
+                throw std::runtime_error("xdmf: Cell values " + name + " have wrong size");
+            }
+
+            // the values are written as they are
+            auto sample = [&values](const numbering_type &, std::vector<double> &)
+                -> std::span<const double> {
+                return values;
+            };
+
+            // record the values
+            _records.push_back({ name, n_components, false, sample });
+
+            // all done
+            return;
+        }
+
+        // write a step at time {time} (the simulation clock, by default) with the current values
+        // of the recorded fields
+        auto write(double time = simulation::simulation().clock()) -> void
+        {
+            // describe the step
+            std::string step = "<Grid Name=\"step_" + std::to_string(_n_steps) + "\" "
+                             + "GridType=\"Uniform\">\n<Time Value=\"" + _time(time)
+                             + "\"/>\n<Topology TopologyType=\"" + cell<cell_type>::type
+                             + "\" NumberOfElements=\"" + std::to_string(_n_cells)
+                             + "\" NodesPerElement=\"" + std::to_string(N) + "\">\n"
+                             + _data_item(_n_cells, N, "Int", _topology_position)
+                             + "</Topology>\n<Geometry GeometryType=\"XYZ\">\n"
+                             + _data_item(_numbering.size(), 3, "Float", _geometry_position)
+                             + "</Geometry>\n";
+
+            // append the values of the fields to the binary file
+            for (const auto & record : _records) {
+                auto values = record.sample(_numbering, _buffer);
+                auto position = _append(values);
+                step += "<Attribute Name=\"" + record.name + "\" AttributeType=\""
+                      + _attribute_type(record.n_components) + "\" Center=\""
+                      + (record.nodal ? "Node" : "Cell") + "\">\n"
+                      + _data_item(
+                            record.nodal ? _numbering.size() : _n_cells, record.n_components,
+                            "Float", position)
+                      + "</Attribute>\n";
+            }
+            step += "</Grid>\n";
+
+            // make the values visible to readers
+            _data.flush();
+
+            // overwrite the closing of the xdmf file with the step, and close it again
+            _xdmf.seekp(_trailer_position);
+            _xdmf << step;
+            _trailer_position = _xdmf.tellp();
+            _xdmf << trailer << std::flush;
+
+            // check that everything went well
+            if (!_data || !_xdmf) {
+                throw std::runtime_error("xdmf: Files " + _filename + " could not be written");
+            }
+
+            // one more step
+            ++_n_steps;
+
+            // all done
+            return;
+        }
+
+        // the number of steps written
+        auto n_steps() const noexcept -> int { return _n_steps; }
+
+      private:
+        // the name of the files (without extension)
+        std::string _filename;
+        // the numbering of the nodes of the mesh
+        numbering_type _numbering;
+        // the number of cells of the mesh
+        std::int64_t _n_cells;
+        // the binary file with the heavy data
+        std::ofstream _data;
+        // the xdmf file with the description of the steps
+        std::ofstream _xdmf;
+        // the position of the end of the binary file
+        std::int64_t _position;
+        // the position of the closing of the xdmf file
+        std::streampos _trailer_position;
+        // the positions of the geometry and of the topology in the binary file
+        std::int64_t _geometry_position;
+        std::int64_t _topology_position;
+        // the recorded fields
+        std::vector<record_t> _records;
+        // a buffer for the values of the fields
+        std::vector<double> _buffer;
+        // the number of steps written
+        int _n_steps;
+    };
+}
+
+
+// end of file
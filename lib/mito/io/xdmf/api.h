@@ -0,0 +1,26 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::xdmf {
+
+    // time series writer alias
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    using time_series_writer_t = TimeSeriesWriter<meshT, coordSystemT>;
+
+    // time series writer factory
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    auto time_series_writer(
+        std::string filename, const meshT & mesh, const coordSystemT & coord_system)
+        -> time_series_writer_t<meshT, coordSystemT>;
+}
+
+
+// end of file
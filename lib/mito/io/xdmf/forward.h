@@ -0,0 +1,19 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::xdmf {
+
+    // class for the writer of a time series of fields on a mesh
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    class TimeSeriesWriter;
+}
+
+
+// end of file
@@ -0,0 +1,36 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::io::xdmf {
+
+    // the xdmf topology type of a geometric simplex
+    template <geometry::geometric_simplex_c cellT>
+    struct cell;
+
+    // specialization for a geometric segment
+    template <geometry::geometric_segment_c cellT>
+    struct cell<cellT> {
+        static constexpr const char * type = "Polyline";
+    };
+
+    // specialization for a geometric triangle
+    template <geometry::geometric_triangle_c cellT>
+    struct cell<cellT> {
+        static constexpr const char * type = "Triangle";
+    };
+
+    // specialization for a geometric tetrahedron
+    template <geometry::geometric_tetrahedron_c cellT>
+    struct cell<cellT> {
+        static constexpr const char * type = "Tetrahedron";
+    };
+}
+
+
+// end of file
@@ -38,17 +38,27 @@ namespace mito::mesh {
         // get the topological family this cell type belongs to (e.g. simplicial cells)
         template <int I>
         using cell_topological_family_type = typename cell_type::cell_topological_family_type<I>;
-        // id type of unoriented cell
-        using cell_id_type = utilities::index_t<cell_type>;
         // this map maps a cell id to a tuple of two integers counting how many times a cell appears
-        // with - or + orientation
-        using orientation_map_type = std::unordered_map<cell_id_type, std::array<int, 2>>;
+        // with + or - orientation
+        using orientation_map_type = OrientationMap;
 
       public:
         // default constructor
         inline Mesh()
         requires(N <= D)
-            : _cells(100)
+            : _cells(100),
+              _orientations(),
+              _has_orientations(false),
+              _tags()
+        {}
+
+        // constructor with the number of cells stored per memory segment
+        inline explicit Mesh(int segment_size)
+        requires(N <= D)
+            : _cells(segment_size),
+              _orientations(),
+              _has_orientations(false),
+              _tags()
         {}
 
         inline ~Mesh() = default;
@@ -67,14 +77,103 @@ namespace mito::mesh {
         Mesh & operator=(Mesh &&) noexcept = delete;
 
       private:
-        inline auto _register_cell_orientation(const cell_type & cell) -> void
+        // add {increment} to the orientations count of the subcells of {cell}
+        inline auto _register_cell_orientation(const cell_type & cell, int increment = +1) const
+            -> void
         {
             // loop on the subcells of {cell}
             for (const auto & subcell : cell.simplex()->composition()) {
-                // increment the orientations count for this cell footprint id, depending on the
+                // update the orientations count for this cell footprint id, depending on the
                 // orientation
-                (subcell->orientation() == +1 ? _orientations[subcell->footprint().id()][0] += 1 :
-                                                _orientations[subcell->footprint().id()][1] += 1);
+                _orientations.add(subcell->footprint().id(), subcell->orientation(), increment);
+            }
+
+            // all done
+            return;
+        }
+
+        // build the orientation map from the cells currently in the mesh (if not built yet)
+        inline auto _build_orientations() const -> void
+        {
+            // nothing to do if the map is up to date
+            if (_has_orientations) {
+                return;
+            }
+
+            // make room for the subcells of all cells (interior subcells are shared by two cells)
+            _orientations.reserve(nCells() * n_vertices);
+
+            // register all cells of the mesh
+            for (const auto & cell : _cells) {
+                _register_cell_orientation(cell);
+            }
+
+            // the map is now up to date and is kept so by {insert} and {erase}
+            _has_orientations = true;
+
+            // all done
+            return;
+        }
+
+        // drop the orientation map (it will be rebuilt on demand)
+        inline auto _drop_orientations() -> void
+        {
+            // release the memory of the map
+            _orientations.clear();
+
+            // mark the map as out of date
+            _has_orientations = false;
+
+            // all done
+            return;
+        }
+
+        // erase all cells sharing the same {key} with a cell that comes earlier in the mesh
+        template <class keyFunctionT>
+        inline auto _erase_duplicates(keyFunctionT key) -> void
+        {
+            // collect the cells in the order they are visited
+            std::vector<cell_type *> cells;
+            cells.reserve(nCells());
+            for (auto & cell : _cells) {
+                cells.push_back(&cell);
+            }
+
+            // the number of cells
+            int n_cells = std::size(cells);
+
+            // pack the key of each cell with its position
+            // (only ids are read here, so no shared pointer is copied by the worker threads)
+            std::vector<std::pair<std::uintptr_t, int>> keys(n_cells);
+            utilities::parallel_for(0, n_cells, [&cells, &keys, &key](int begin, int end) {
+                for (int i = begin; i < end; ++i) {
+                    keys[i] = { key(*cells[i]), i };
+                }
+            });
+
+            // sort the packed keys, so that duplicates are contiguous and the first occurrence of
+            // each key comes first
+            utilities::parallel_sort(keys);
+
+            // all cells in a run of equal keys but the first one are duplicates
+            std::vector<char> duplicate(n_cells, 0);
+            utilities::parallel_for(1, n_cells, [&keys, &duplicate](int begin, int end) {
+                for (int i = begin; i < end; ++i) {
+                    if (keys[i].first == keys[i - 1].first) {
+                        duplicate[keys[i].second] = 1;
+                    }
+                }
+            });
+
+            // drop the orientation map, so that it is rebuilt once on demand
+            _drop_orientations();
+
+            // erase the duplicates (and their tags) in one pass
+            for (int i = 0; i < n_cells; ++i) {
+                if (duplicate[i]) {
+                    _tags.erase(cells[i]);
+                    _cells.erase(*cells[i]);
+                }
             }
 
             // all done
@@ -103,41 +202,58 @@ namespace mito::mesh {
         // erase cell at location {cell}
         inline auto erase(cell_type & cell) -> void
         {
+            // erase the tag of the cell
+            _tags.erase(&cell);
+
             // erase the cell from the mesh
             bool cell_was_erased = _cells.erase(cell);
-            // if the cell was in fact erased from the cell
-            if (cell_was_erased) {
-                // loop on the subcells of {cell}
-                for (const auto & subcell : cell.simplex()->composition()) {
-                    // decrement the orientations count for this cell footprint id, depending on
-                    // the orientation
-                    (subcell->orientation() == +1 ?
-                         _orientations[subcell->footprint().id()][0] -= 1 :
-                         _orientations[subcell->footprint().id()][1] -= 1);
-
-                    // cleanup orientation map
-                    if (_orientations[subcell->footprint().id()] == std::array<int, 2>{ 0, 0 }) {
-                        _orientations.erase(subcell->footprint().id());
-                    }
-                }
+            // if the cell was in fact erased from the mesh and the orientation map is in use
+            if (cell_was_erased && _has_orientations) {
+                // decrement the orientations count of the subcells of {cell}
+                _register_cell_orientation(cell, -1);
             }
 
             // all done
             return;
         }
 
+        // the tag of {cell} in this mesh (e.g. the id of the cell set it was read with), or 0 if
+        // untagged
+        inline auto tag(const cell_type & cell) const -> int
+        {
+            // look up the tag of the cell
+            auto tag = _tags.find(&cell);
+
+            // all done
+            return tag == std::end(_tags) ? 0 : tag->second;
+        }
+
+        // tag {cell} in this mesh with {tag} (each cell has its own tag, even if it shares its
+        // simplex with a geometrical duplicate)
+        inline auto tag(const cell_type & cell, int tag) -> void
+        {
+            // record the tag of the cell
+            _tags.insert_or_assign(&cell, tag);
+
+            // all done
+            return;
+        }
+
+        // reserve room for the tags of {n_cells} cells
+        inline auto reserve_tags(int n_cells) -> void
+        {
+            _tags.reserve(n_cells);
+
+            // all done
+            return;
+        }
+
         // erase topological duplicates
         inline auto erase_topological_duplicates() -> void
         {
-            using simplex_type = typename cell_type::unoriented_simplex_type;
-            std::unordered_set<simplex_type, utilities::hash_function<simplex_type>> simplices;
-
-            for (auto & cell : _cells) {
-                auto [_, was_inserted] = simplices.insert(cell.simplex()->footprint());
-                if (!was_inserted) {
-                    erase(cell);
-                }
-            }
+            // two cells are topological duplicates if they share the same footprint
+            _erase_duplicates(
+                [](const cell_type & cell) { return cell.simplex()->footprint().id(); });
 
             // all done
             return;
@@ -146,15 +262,8 @@ namespace mito::mesh {
         // erase geometrical duplicates
         inline auto erase_geometrical_duplicates() -> void
         {
-            using simplex_type = typename cell_type::simplex_type;
-            std::unordered_set<simplex_type, utilities::hash_function<simplex_type>> simplices;
-
-            for (auto & cell : _cells) {
-                auto [_, was_inserted] = simplices.insert(cell.simplex());
-                if (!was_inserted) {
-                    erase(cell);
-                }
-            }
+            // two cells are geometrical duplicates if they share the same oriented simplex
+            _erase_duplicates([](const cell_type & cell) { return cell.simplex().id(); });
 
             // all done
             return;
@@ -162,10 +271,12 @@ namespace mito::mesh {
 
         inline auto isOnBoundary(const cell_topological_family_type<N - 1> & cell) const -> bool
         {
+            // build the orientation map on first use
+            _build_orientations();
+
             // count how many times this oriented cell occurs in the mesh with opposite orientation
-            int count = 0;
-            (cell->orientation() == -1 ? count = _orientations.at(cell->footprint().id())[0] :
-                                         count = _orientations.at(cell->footprint().id())[1]);
+            auto counts = _orientations.counts(cell->footprint().id());
+            int count = (cell->orientation() == -1 ? counts[0] : counts[1]);
 
             // the cell is on the boundary if it never occurs in the mesh with opposite
             // orientation
@@ -180,8 +291,10 @@ namespace mito::mesh {
         inline auto insert(const cell_type & cell) -> cell_type &
         requires(N > 0)
         {
-            // register {cell} in the orientation map
-            _register_cell_orientation(cell);
+            // register {cell} in the orientation map (if the map is in use)
+            if (_has_orientations) {
+                _register_cell_orientation(cell);
+            }
 
             // add the cell to the collection of cells
             return _cells.emplace(cell);
@@ -194,13 +307,82 @@ namespace mito::mesh {
             // instantiate cell and add it to the collection of cells
             auto & cell = _cells.emplace(nodes);
 
-            // register {cell} in the orientation map
-            _register_cell_orientation(cell);
+            // register {cell} in the orientation map (if the map is in use)
+            if (_has_orientations) {
+                _register_cell_orientation(cell);
+            }
 
             // all done
             return cell;
         }
 
+        // build and insert the cells with the {nodes} numbered in {connectivity} ({n_vertices} per
+        // cell), tagging each cell with its entry in {tags} (if any; zero tags are not stored)
+        // The simplices of all the cells are instantiated in bulk in the topology, so that each
+        // distinct simplex (and subsimplex) is looked up (or created) only once; nothing is
+        // inserted unless {connectivity} and {tags} are valid
+        inline auto insert(
+            std::span<const node_type> nodes, std::span<const int> connectivity,
+            std::span<const int> tags = {}) -> void
+        requires(N > 0)
+        {
+            // the number of nodes and of cells
+            int n_nodes = std::size(nodes);
+            int n_cells = std::size(connectivity) / n_vertices;
+
+            // check that there is a tag per cell, if any
+            if (!std::empty(tags) && std::ssize(tags) != n_cells) {
+                throw std::runtime_error("mesh: Number of tags does not match number of cells");
+            }
+
+            // check that the connectivity only refers to existing nodes
+            if (std::ranges::any_of(
+                    connectivity, [n_nodes](int index) { return index < 0 || index >= n_nodes; })) {
+                throw std::runtime_error("mesh: Connectivity refers to a missing node");
+            }
+
+            // the vertices of the cells
+            std::vector<topology::vertex_simplex_composition_t<N>> vertices(n_cells);
+            for (int e = 0; e < n_cells; ++e) {
+                for (int a = 0; a < n_vertices; ++a) {
+                    vertices[e][a] = nodes[connectivity[n_vertices * e + a]]->vertex();
+                }
+            }
+
+            // instantiate the simplices of the cells in bulk
+            auto simplices = topology::topology().simplices<N>(vertices);
+
+            // make room for the tags of the cells
+            if (!std::empty(tags)) {
+                _tags.reserve(std::size(_tags) + n_cells);
+            }
+
+            // insert the cells
+            for (int e = 0; e < n_cells; ++e) {
+                // the nodes of the cell
+                nodes_type cell_nodes;
+                for (int a = 0; a < n_vertices; ++a) {
+                    cell_nodes[a] = nodes[connectivity[n_vertices * e + a]];
+                }
+
+                // add the cell, riding on its simplex, to the collection of cells
+                auto & cell = _cells.emplace(simplices[e], cell_nodes);
+
+                // register {cell} in the orientation map (if the map is in use)
+                if (_has_orientations) {
+                    _register_cell_orientation(cell);
+                }
+
+                // store the tag of the cell
+                if (!std::empty(tags) && tags[e] != 0) {
+                    tag(cell, tags[e]);
+                }
+            }
+
+            // all done
+            return;
+        }
+
         // insert {cell} in mesh
       inline auto insert(const cell_type & cell) -> cell_type & requires(N == 0) {
           // add the cell to the collection of cells
@@ -211,8 +393,15 @@ namespace mito::mesh {
           // container to store the mesh cells
           cells_type _cells;
 
-        // container to store how many times a cell appears with a given orientation
-        orientation_map_type _orientations;
+        // container to store how many times a cell appears with a given orientation (built lazily
+        // on the first boundary query)
+        mutable orientation_map_type _orientations;
+
+        // whether {_orientations} is up to date with the cells in the mesh
+        mutable bool _has_orientations;
+
+        // the tags of the cells, by address of the cell in {_cells} (which is stable)
+        std::unordered_map<const cell_type *, int> _tags;
     };
 
 }    // namespace mito
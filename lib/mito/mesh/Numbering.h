@@ -0,0 +1,145 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::mesh {
+
+    // a dense numbering 0, ..., size() - 1 of the nodes of a mesh, where two nodes get the same
+    // number if they have the same key (e.g. the id of their vertex, of their point or of the node
+    // itself); numbers are assigned in order of first appearance while iterating on the cells
+    // Note that the numbering refers to the nodes stored in the mesh, and is invalidated by any
+    // modification of the mesh
+    template <class meshT>
+    class Numbering {
+
+      public:
+        // the mesh type
+        using mesh_type = meshT;
+        // the cell type
+        using cell_type = typename mesh_type::cell_type;
+        // the node type
+        using node_type = typename mesh_type::node_type;
+        // the number of nodes per cell
+        static constexpr int n_vertices = mesh_type::n_vertices;
+
+      public:
+        // constructor from the {mesh} and the {key} identifying its nodes
+        template <class keyFunctionT>
+        inline Numbering(const mesh_type & mesh, keyFunctionT key) :
+            _connectivity(),
+            _nodes()
+        {
+            // collect the cells in the order they are visited
+            std::vector<const cell_type *> cells;
+            cells.reserve(mesh.nCells());
+            for (const auto & cell : mesh.cells()) {
+                cells.push_back(&cell);
+            }
+
+            // the number of cells
+            int n_cells = std::size(cells);
+
+            // the number of node entries in the cells
+            int n_entries = n_vertices * n_cells;
+
+            // pack the key of each node entry with its position {n_vertices * cell + node}
+            // (only ids are read here, so no shared pointer is copied by the worker threads)
+            std::vector<std::pair<utilities::index_t<node_type>, int>> keys(n_entries);
+            utilities::parallel_for(0, n_cells, [&cells, &keys, &key](int begin, int end) {
+                for (int e = begin; e < end; ++e) {
+                    const auto & nodes = cells[e]->nodes();
+                    for (int a = 0; a < n_vertices; ++a) {
+                        keys[n_vertices * e + a] = { key(nodes[a]), n_vertices * e + a };
+                    }
+                }
+            });
+
+            // sort the packed keys, so that entries with the same key are contiguous and the first
+            // appearance of each key comes first
+            utilities::parallel_sort(keys);
+
+            // the position of the first appearance of the key of each entry
+            std::vector<int> first(n_entries);
+            utilities::parallel_for(0, n_entries, [&keys, &first](int begin, int end) {
+                // rewind to the start of the run of equal keys this chunk begins in
+                int leader = begin;
+                while (leader > 0 && keys[leader - 1].first == keys[begin].first) {
+                    --leader;
+                }
+                leader = keys[leader].second;
+                for (int i = begin; i < end; ++i) {
+                    if (i > 0 && keys[i].first != keys[i - 1].first) {
+                        leader = keys[i].second;
+                    }
+                    first[keys[i].second] = leader;
+                }
+            });
+
+            // number the first appearances in the order they are visited
+            std::vector<int> number(n_entries, -1);
+            for (int i = 0; i < n_entries; ++i) {
+                if (first[i] == i) {
+                    number[i] = std::size(_nodes);
+                    _nodes.push_back(&cells[i / n_vertices]->nodes()[i % n_vertices]);
+                }
+            }
+
+            // propagate the numbers to all the entries
+            _connectivity.resize(n_entries);
+            utilities::parallel_for(0, n_entries, [this, &first, &number](int begin, int end) {
+                for (int i = begin; i < end; ++i) {
+                    _connectivity[i] = number[first[i]];
+                }
+            });
+        }
+
+        // destructor
+        inline ~Numbering() = default;
+
+        // move constructor
+        inline Numbering(Numbering &&) noexcept = default;
+
+      private:
+        // delete copy constructor
+        Numbering(const Numbering &) = delete;
+
+        // delete assignment operator
+        Numbering & operator=(const Numbering &) = delete;
+
+        // delete move assignment operator
+        Numbering & operator=(Numbering &&) noexcept = delete;
+
+      public:
+        // the number of distinct nodes
+        inline auto size() const noexcept -> int { return std::size(_nodes); }
+
+        // the number of the {a}-th node of the {e}-th cell
+        inline auto operator()(int e, int a) const -> int
+        {
+            return _connectivity[n_vertices * e + a];
+        }
+
+        // the numbers of the nodes of all the cells, {n_vertices} per cell
+        inline auto connectivity() const noexcept -> const std::vector<int> &
+        {
+            return _connectivity;
+        }
+
+        // the node representing number {n} (its first appearance in the mesh)
+        inline auto node(int n) const -> const node_type & { return *_nodes[n]; }
+
+      private:
+        // the numbers of the nodes of all the cells
+        std::vector<int> _connectivity;
+        // the representative of each number
+        std::vector<const node_type *> _nodes;
+    };
+}
+
+
+// end of file
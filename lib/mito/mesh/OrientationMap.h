@@ -0,0 +1,180 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+/*
+ * This class counts how many times each face of a mesh appears with + and - orientation.
+ *
+ * The counts are stored in a flat open-addressing table (linear probing) keyed by the id of the
+ * face footprint, so that no memory is allocated per face. Since faces are never removed from the
+ * table (erasing a cell only decrements the counts), no tombstones are needed.
+ *
+ */
+
+namespace mito::mesh {
+
+    class OrientationMap {
+
+      public:
+        // the type of the keys (the id of the face footprint)
+        using key_type = std::uintptr_t;
+        // the counts of a face with + and - orientation
+        using value_type = std::array<int, 2>;
+
+      private:
+        // the key marking an empty slot (no footprint lives at address zero)
+        static constexpr key_type empty = 0;
+
+      public:
+        // constructor
+        OrientationMap() : _keys(), _counts(), _size(0), _shift(64) {}
+
+        // destructor
+        ~OrientationMap() = default;
+
+        // move constructor
+        OrientationMap(OrientationMap &&) noexcept = default;
+
+        // move assignment operator
+        OrientationMap & operator=(OrientationMap &&) noexcept = default;
+
+      private:
+        // delete copy constructor
+        OrientationMap(const OrientationMap &) = delete;
+
+        // delete assignment operator
+        OrientationMap & operator=(const OrientationMap &) = delete;
+
+      public:
+        // the number of faces in the table
+        auto size() const noexcept -> int { return _size; }
+
+        // remove all faces from the table and release the memory
+        auto clear() -> void
+        {
+            _keys = std::vector<key_type>();
+            _counts = std::vector<value_type>();
+            _size = 0;
+            _shift = 64;
+
+            // all done
+            return;
+        }
+
+        // make room for at least {n} faces without rehashing
+        auto reserve(int n) -> void
+        {
+            // keep the load factor below one half
+            if (2 * n > std::ssize(_keys)) {
+                _rehash(2 * n);
+            }
+
+            // all done
+            return;
+        }
+
+        // add {increment} to the count of face {key} with orientation {orientation}
+        auto add(key_type key, int orientation, int increment) -> void
+        {
+            // keep the load factor below one half
+            if (2 * (_size + 1) > std::ssize(_keys)) {
+                _rehash(2 * (_size + 1));
+            }
+
+            // find the slot of {key}
+            auto slot = _find(key);
+
+            // if the face is new, claim the slot
+            if (_keys[slot] == empty) {
+                _keys[slot] = key;
+                ++_size;
+            }
+
+            // update the count
+            _counts[slot][orientation == +1 ? 0 : 1] += increment;
+
+            // all done
+            return;
+        }
+
+        // the counts of face {key} with + and - orientation ({0, 0} if the face is unknown)
+        auto counts(key_type key) const -> value_type
+        {
+            // an empty table knows no faces
+            if (_size == 0) {
+                return { 0, 0 };
+            }
+
+            // find the slot of {key}
+            auto slot = _find(key);
+
+            // all done
+            return _keys[slot] == empty ? value_type{ 0, 0 } : _counts[slot];
+        }
+
+      private:
+        // the slot holding {key}, or the empty slot where it would be inserted
+        auto _find(key_type key) const -> std::size_t
+        {
+            // the mask for wrapping around the table
+            auto mask = std::size(_keys) - 1;
+
+            // start from the (fibonacci) hash of the key and probe linearly
+            auto slot = static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> _shift);
+            while (_keys[slot] != empty && _keys[slot] != key) {
+                slot = (slot + 1) & mask;
+            }
+
+            // all done
+            return slot;
+        }
+
+        // grow the table to at least {n} slots and reinsert the faces
+        auto _rehash(int n) -> void
+        {
+            // the new number of slots (a power of two)
+            std::size_t n_slots = 16;
+            int bits = 4;
+            while (n_slots < static_cast<std::size_t>(n)) {
+                n_slots *= 2;
+                ++bits;
+            }
+
+            // swap in the new table
+            auto keys = std::exchange(_keys, std::vector<key_type>(n_slots, empty));
+            auto counts = std::exchange(_counts, std::vector<value_type>(n_slots, { 0, 0 }));
+            _shift = 64 - bits;
+
+            // reinsert the faces
+            for (std::size_t i = 0; i < std::size(keys); ++i) {
+                if (keys[i] != empty) {
+                    auto slot = _find(keys[i]);
+                    _keys[slot] = keys[i];
+                    _counts[slot] = counts[i];
+                }
+            }
+
+            // all done
+            return;
+        }
+
+      private:
+        // the face keys of each slot
+        std::vector<key_type> _keys;
+        // the orientation counts of each slot
+        std::vector<value_type> _counts;
+        // the number of faces in the table
+        int _size;
+        // the shift turning the 64-bit hash of a key into a slot
+        int _shift;
+    };
+
+}    // namespace mito::mesh
+
+
+// end of file
@@ -13,6 +13,26 @@ namespace mito::mesh {
     template <class cellT>
     auto mesh() -> mesh_t<cellT>;
 
+    // mesh factory (with {segment_size} cells stored per memory segment)
+    template <class cellT>
+    auto mesh(int segment_size) -> mesh_t<cellT>;
+
+    // dense numbering of the nodes of {mesh}, where nodes with the same {key} share a number
+    template <mesh_c meshT, class keyFunctionT>
+    auto numbering(const meshT & mesh, keyFunctionT key) -> numbering_t<meshT>;
+
+    // dense numbering of the nodes of {mesh}, where nodes sharing a vertex share a number
+    template <mesh_c meshT>
+    auto vertex_numbering(const meshT & mesh) -> numbering_t<meshT>;
+
+    // dense numbering of the nodes of {mesh}, where nodes sharing a point share a number
+    template <mesh_c meshT>
+    auto point_numbering(const meshT & mesh) -> numbering_t<meshT>;
+
+    // dense numbering of the nodes of {mesh}, where each node has its own number
+    template <mesh_c meshT>
+    auto node_numbering(const meshT & mesh) -> numbering_t<meshT>;
+
     // assemble boundary mesh of {mesh}
     template <int N, int D, template <int, int> class cellT>
     auto boundary(const mesh_t<cellT<N, D>> & mesh)
@@ -0,0 +1,262 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::mesh {
+
+    // the result of a local refinement: the refined mesh and the indices (in the order of
+    // iteration on the refined mesh) of the children of each cell of the original mesh (in the
+    // order of iteration on the original mesh)
+    template <class cellT>
+    struct refinement_t {
+        // the refined mesh
+        mesh_t<cellT> mesh;
+        // the parent -> children map
+        std::vector<std::vector<int>> children;
+    };
+
+    // refine the cells of {mesh} for which {marker(cell)} is true by bisection, bisecting also
+    // as many other cells as needed to leave no hanging nodes
+    // Triangles are refined by newest vertex bisection (the initial refinement edge of each
+    // triangle is its longest edge); tetrahedra are refined by longest edge bisection, with ties
+    // broken consistently across neighboring cells
+    template <class cellT, geometry::coordinates_c coordT, class markerT>
+    requires(
+        utilities::same_dim_c<cellT, coordT> && (cellT::order == 2 || cellT::order == 3)
+        && std::predicate<markerT, const cellT &>)
+    auto bisect(
+        const mesh_t<cellT> & mesh, geometry::coordinate_system_t<coordT> & coordinate_system,
+        markerT && marker) -> refinement_t<cellT>
+    {
+        // the order of the cells
+        constexpr int N = cellT::order;
+        // the number of vertices per cell
+        constexpr int V = cellT::n_vertices;
+        // the dimension of the physical space
+        constexpr int D = cellT::dim;
+        // the node type
+        using node_type = typename cellT::node_type;
+
+        // a cell during refinement: its nodes, its ancestor in the original mesh and whether it
+        // is a leaf of the refinement
+        struct element_type {
+            std::array<int, V> nodes;
+            int parent;
+            bool active;
+        };
+
+        // a dense numbering of the nodes of the original mesh
+        auto numbering = node_numbering(mesh);
+
+        // the nodes of the refined mesh and their coordinates (starting from those of the
+        // original mesh)
+        std::vector<node_type> nodes;
+        std::vector<coordT> coordinates;
+        for (int n = 0; n < numbering.size(); ++n) {
+            nodes.push_back(numbering.node(n));
+            coordinates.push_back(coordinate_system.coordinates(nodes.back()->point()));
+        }
+
+        // the squared length of the edge between nodes {a} and {b}
+        auto length = [&](int a, int b) -> double {
+            auto delta = coordinates[b] - coordinates[a];
+            double result = 0.0;
+            for (int d = 0; d < D; ++d) {
+                result += delta[d] * delta[d];
+            }
+            return result;
+        };
+
+        // whether edge {a, b} is to be bisected before edge {c, d} (longer first, then the edge
+        // with the lowest node numbers, so that all cells sharing edges agree)
+        auto precedes = [&](int a, int b, int c, int d) -> bool {
+            double l_ab = length(a, b);
+            double l_cd = length(c, d);
+            if (l_ab != l_cd) {
+                return l_ab > l_cd;
+            }
+            return std::minmax(a, b) < std::minmax(c, d);
+        };
+
+        // the local vertices of the refinement edge of an element
+        auto refinement_edge = [&](const element_type & element) -> std::pair<int, int> {
+            // triangles keep the refinement edge (opposite to the newest vertex) first
+            if constexpr (N == 2) {
+                return { 0, 1 };
+            }
+            // tetrahedra are bisected along their longest edge
+            else {
+                std::pair<int, int> edge = { 0, 1 };
+                for (int i = 0; i < V; ++i) {
+                    for (int j = i + 1; j < V; ++j) {
+                        if (precedes(
+                                element.nodes[i], element.nodes[j], element.nodes[edge.first],
+                                element.nodes[edge.second])) {
+                            edge = { i, j };
+                        }
+                    }
+                }
+                return edge;
+            }
+        };
+
+        // the elements of the refinement and the elements marked for bisection
+        std::vector<element_type> elements;
+        std::vector<int> marked;
+
+        // number the cells of the original mesh
+        int n_parents = 0;
+        for (const auto & cell : mesh.cells()) {
+            element_type element = { {}, n_parents, true };
+            for (int a = 0; a < V; ++a) {
+                element.nodes[a] = numbering(n_parents, a);
+            }
+            // rotate the nodes of triangles so that the longest edge comes first (a cyclic
+            // permutation preserves the orientation)
+            if constexpr (N == 2) {
+                int first = 0;
+                for (int a = 1; a < V; ++a) {
+                    if (precedes(
+                            element.nodes[a], element.nodes[(a + 1) % V],
+                            element.nodes[first], element.nodes[(first + 1) % V])) {
+                        first = a;
+                    }
+                }
+                std::rotate(
+                    std::begin(element.nodes), std::begin(element.nodes) + first,
+                    std::end(element.nodes));
+            }
+            if (marker(cell)) {
+                marked.push_back(std::ssize(elements));
+            }
+            elements.push_back(element);
+            ++n_parents;
+        }
+
+        // the midpoints of the bisected edges
+        std::unordered_map<std::uint64_t, int> midpoints;
+
+        // the key of edge {a, b}
+        auto edge_key = [](int a, int b) -> std::uint64_t {
+            auto [lo, hi] = std::minmax(a, b);
+            return (static_cast<std::uint64_t>(lo) << 32) | static_cast<std::uint64_t>(hi);
+        };
+
+        // the midpoint of edge {a, b} (created if needed)
+        auto midpoint = [&](int a, int b) -> int {
+            auto [it, inserted] = midpoints.insert({ edge_key(a, b), std::ssize(nodes) });
+            if (inserted) {
+                auto node = midnode(nodes[a], nodes[b], coordinate_system);
+                nodes.push_back(node);
+                coordinates.push_back(coordinate_system.coordinates(node->point()));
+            }
+            return it->second;
+        };
+
+        // bisect the marked elements, then the elements with hanging nodes, until none is left
+        while (!std::empty(marked)) {
+            for (auto e : marked) {
+                // skip elements that have already been bisected
+                if (!elements[e].active) {
+                    continue;
+                }
+
+                // bisect the element along its refinement edge
+                auto element = elements[e];
+                auto [i, j] = refinement_edge(element);
+                int m = midpoint(element.nodes[i], element.nodes[j]);
+                elements[e].active = false;
+
+                // the two children replace one of the endpoints of the refinement edge with the
+                // midpoint (which preserves the orientation)
+                auto child_a = element;
+                auto child_b = element;
+                if constexpr (N == 2) {
+                    // for triangles, the nodes are also rotated so that the refinement edge of
+                    // the children is the one opposite to the midpoint (the newest vertex)
+                    child_a.nodes = { element.nodes[2], element.nodes[0], m };
+                    child_b.nodes = { element.nodes[1], element.nodes[2], m };
+                } else {
+                    child_a.nodes[j] = m;
+                    child_b.nodes[i] = m;
+                }
+
+                elements.push_back(child_a);
+                elements.push_back(child_b);
+            }
+
+            // collect the elements with a bisected edge
+            marked.clear();
+            for (int e = 0; e < std::ssize(elements); ++e) {
+                if (!elements[e].active) {
+                    continue;
+                }
+                bool hanging = false;
+                for (int a = 0; a < V && !hanging; ++a) {
+                    for (int b = a + 1; b < V && !hanging; ++b) {
+                        hanging = midpoints.contains(
+                            edge_key(elements[e].nodes[a], elements[e].nodes[b]));
+                    }
+                }
+                if (hanging) {
+                    marked.push_back(e);
+                }
+            }
+        }
+
+        // assemble the refined mesh and the parent -> children map
+        refinement_t<cellT> refinement = { mito::mesh::mesh<cellT>(), {} };
+        refinement.children.resize(n_parents);
+        int n_children = 0;
+        for (const auto & element : elements) {
+            if (!element.active) {
+                continue;
+            }
+            typename cellT::nodes_type cell_nodes;
+            for (int a = 0; a < V; ++a) {
+                cell_nodes[a] = nodes[element.nodes[a]];
+            }
+            refinement.mesh.insert(cell_nodes);
+            refinement.children[element.parent].push_back(n_children++);
+        }
+
+        // all done
+        return refinement;
+    }
+
+    // refine the cells of {mesh} whose error indicator (listed in the order of iteration on the
+    // cells) is at least {fraction} of the largest indicator
+    template <class cellT, geometry::coordinates_c coordT>
+    requires(utilities::same_dim_c<cellT, coordT> && (cellT::order == 2 || cellT::order == 3))
+    auto bisect(
+        const mesh_t<cellT> & mesh, geometry::coordinate_system_t<coordT> & coordinate_system,
+        const std::vector<double> & indicators, double fraction) -> refinement_t<cellT>
+    {
+        // sanity check
+        assert(std::ssize(indicators) == mesh.nCells());
+
+        // the threshold of the indicator for refinement
+        double threshold = 0.0;
+        if (!std::empty(indicators)) {
+            threshold = fraction * *std::ranges::max_element(indicators);
+        }
+
+        // mark the cells by their position in the mesh
+        int cell = 0;
+        auto marker = [&](const cellT &) -> bool {
+            double indicator = indicators[cell++];
+            return indicator > 0.0 && indicator >= threshold;
+        };
+
+        // all done
+        return bisect(mesh, coordinate_system, marker);
+    }
+}
+
+
+// end of file
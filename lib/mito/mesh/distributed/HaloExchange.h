@@ -0,0 +1,300 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::mesh::distributed {
+
+    // the exchange of the values of distributed items (e.g. the nodes or the cells of a partition)
+    // between the task owning each item and the tasks holding a copy of it, with persistent
+    // nonblocking requests set up once and restarted at each exchange
+    // The values of the items are stored contiguously, {n_components} per item, in the order of
+    // the items given at construction
+    class HaloExchange {
+
+      private:
+        // the tags of the messages
+        static constexpr int update_tag = 1;
+        static constexpr int accumulate_tag = 2;
+
+      public:
+        // constructor from the global ids {ids} of the items held by this task and the tasks
+        // {owners} owning them
+        inline HaloExchange(
+            const std::vector<global_id_t> & ids, const std::vector<int> & owners,
+            int n_components, MPI_Comm communicator = MPI_COMM_WORLD) :
+            _n_components(n_components),
+            _communicator(communicator),
+            _copies(),
+            _shared(),
+            _copy_buffer(),
+            _shared_buffer(),
+            _update_requests(),
+            _accumulate_requests()
+        {
+            // the id of this task and the number of tasks
+            int task_id = 0;
+            int n_tasks = 0;
+            MPI_Comm_rank(communicator, &task_id);
+            MPI_Comm_size(communicator, &n_tasks);
+
+            // the items held by this task and owned by other tasks
+            std::vector<int> destinations;
+            std::vector<global_id_t> requests;
+            for (int i = 0; i < std::ssize(ids); ++i) {
+                if (owners[i] != task_id) {
+                    _copies.push_back(i);
+                    destinations.push_back(owners[i]);
+                    requests.push_back(ids[i]);
+                }
+            }
+
+            // group the copies by owner
+            auto [order, copy_counts] = send_order(destinations, n_tasks);
+            std::vector<int> copies(std::size(order));
+            for (int k = 0; k < std::ssize(order); ++k) {
+                copies[k] = _copies[order[k]];
+            }
+            _copies = std::move(copies);
+
+            // ask the owners for the items
+            auto [received, sources] = send(requests, 1, destinations, communicator);
+
+            // the items owned by this task (sorted by global id)
+            std::vector<std::pair<global_id_t, int>> owned;
+            for (int i = 0; i < std::ssize(ids); ++i) {
+                if (owners[i] == task_id) {
+                    owned.push_back({ ids[i], i });
+                }
+            }
+            std::sort(std::begin(owned), std::end(owned));
+
+            // the items owned by this task with copies on other tasks (grouped by task)
+            std::vector<int> shared_counts(n_tasks, 0);
+            for (int k = 0; k < std::ssize(received); ++k) {
+                auto item = std::lower_bound(
+                    std::begin(owned), std::end(owned),
+                    std::pair(received[k], std::numeric_limits<int>::min()));
+                assert(item != std::end(owned) && item->first == received[k]);
+                _shared.push_back(item->second);
+                ++shared_counts[sources[k]];
+            }
+
+            // the buffers of the values of the copies and of the shared items
+            _copy_buffer.resize(n_components * std::size(_copies));
+            _shared_buffer.resize(n_components * std::size(_shared));
+
+            // set up the persistent requests with each neighboring task
+            int copy_offset = 0;
+            int shared_offset = 0;
+            for (int task = 0; task < n_tasks; ++task) {
+                // receive the values of the copies from their owner, and send back contributions
+                if (copy_counts[task] > 0) {
+                    _add_requests(_copy_buffer, copy_offset, copy_counts[task], task);
+                    copy_offset += copy_counts[task];
+                }
+                // send the values of the shared items to the tasks with a copy, and receive back
+                // their contributions
+                if (shared_counts[task] > 0) {
+                    _add_requests(_shared_buffer, shared_offset, shared_counts[task], task, true);
+                    shared_offset += shared_counts[task];
+                }
+            }
+        }
+
+        // destructor
+        inline ~HaloExchange()
+        {
+            // nothing to free if MPI has already been finalized
+            int finalized = 0;
+            MPI_Finalized(&finalized);
+            if (finalized) {
+                return;
+            }
+
+            // free the persistent requests
+            for (auto & request : _update_requests) {
+                MPI_Request_free(&request);
+            }
+            for (auto & request : _accumulate_requests) {
+                MPI_Request_free(&request);
+            }
+        }
+
+      private:
+        // delete copy constructor
+        HaloExchange(const HaloExchange &) = delete;
+
+        // delete move constructor
+        HaloExchange(HaloExchange &&) = delete;
+
+        // delete assignment operator
+        HaloExchange & operator=(const HaloExchange &) = delete;
+
+        // delete move assignment operator
+        HaloExchange & operator=(HaloExchange &&) = delete;
+
+      private:
+        // set up the persistent requests for the {count} items starting at {offset} in {buffer},
+        // exchanged with {task} (as the owner of the items, if {owner})
+        inline auto _add_requests(
+            std::vector<double> & buffer, int offset, int count, int task, bool owner = false)
+            -> void
+        {
+            // the values of the items
+            auto values = buffer.data() + _n_components * offset;
+            int size = _n_components * count;
+
+            // the owner sends the values and receives the contributions, the other tasks do the
+            // opposite
+            MPI_Request update;
+            MPI_Request accumulate;
+            if (owner) {
+                MPI_Send_init(values, size, MPI_DOUBLE, task, update_tag, _communicator, &update);
+                MPI_Recv_init(
+                    values, size, MPI_DOUBLE, task, accumulate_tag, _communicator, &accumulate);
+            } else {
+                MPI_Recv_init(values, size, MPI_DOUBLE, task, update_tag, _communicator, &update);
+                MPI_Send_init(
+                    values, size, MPI_DOUBLE, task, accumulate_tag, _communicator, &accumulate);
+            }
+            _update_requests.push_back(update);
+            _accumulate_requests.push_back(accumulate);
+
+            // all done
+            return;
+        }
+
+        // copy the values of {items} from {values} to {buffer}
+        inline auto _pack(
+            std::span<const double> values, const std::vector<int> & items,
+            std::vector<double> & buffer) const -> void
+        {
+            for (int k = 0; k < std::ssize(items); ++k) {
+                for (int c = 0; c < _n_components; ++c) {
+                    buffer[_n_components * k + c] = values[_n_components * items[k] + c];
+                }
+            }
+
+            // all done
+            return;
+        }
+
+      public:
+        // the number of items held by this task and owned by other tasks
+        inline auto n_copies() const noexcept -> int { return std::size(_copies); }
+
+        // the number of items owned by this task with copies on other tasks (counted once per
+        // copy)
+        inline auto n_shared() const noexcept -> int { return std::size(_shared); }
+
+        // start sending the {values} of the items owned by this task to the tasks with a copy
+        inline auto begin_update(std::span<const double> values) -> void
+        {
+            // pack the values of the shared items
+            _pack(values, _shared, _shared_buffer);
+
+            // start the exchange
+            MPI_Startall(std::size(_update_requests), _update_requests.data());
+
+            // all done
+            return;
+        }
+
+        // complete the exchange started by {begin_update}, overwriting the {values} of the copies
+        // with the values of their owners
+        inline auto end_update(std::span<double> values) -> void
+        {
+            // wait for the exchange to complete
+            MPI_Waitall(std::size(_update_requests), _update_requests.data(), MPI_STATUSES_IGNORE);
+
+            // unpack the values of the copies
+            for (int k = 0; k < std::ssize(_copies); ++k) {
+                for (int c = 0; c < _n_components; ++c) {
+                    values[_n_components * _copies[k] + c] = _copy_buffer[_n_components * k + c];
+                }
+            }
+
+            // all done
+            return;
+        }
+
+        // overwrite the {values} of the copies with the values of their owners
+        inline auto update(std::span<double> values) -> void
+        {
+            begin_update(values);
+            end_update(values);
+
+            // all done
+            return;
+        }
+
+        // start sending the {values} of the copies to their owners
+        inline auto begin_accumulate(std::span<const double> values) -> void
+        {
+            // pack the values of the copies
+            _pack(values, _copies, _copy_buffer);
+
+            // start the exchange
+            MPI_Startall(std::size(_accumulate_requests), _accumulate_requests.data());
+
+            // all done
+            return;
+        }
+
+        // complete the exchange started by {begin_accumulate}, adding the values of the copies to
+        // the {values} of the items owned by this task
+        inline auto end_accumulate(std::span<double> values) -> void
+        {
+            // wait for the exchange to complete
+            MPI_Waitall(
+                std::size(_accumulate_requests), _accumulate_requests.data(), MPI_STATUSES_IGNORE);
+
+            // add the contributions of the copies
+            for (int k = 0; k < std::ssize(_shared); ++k) {
+                for (int c = 0; c < _n_components; ++c) {
+                    values[_n_components * _shared[k] + c] += _shared_buffer[_n_components * k + c];
+                }
+            }
+
+            // all done
+            return;
+        }
+
+        // add the {values} of the copies to the values of their owners
+        // (e.g. to assemble the contributions of the cells of all tasks to the shared nodes)
+        inline auto accumulate(std::span<double> values) -> void
+        {
+            begin_accumulate(values);
+            end_accumulate(values);
+
+            // all done
+            return;
+        }
+
+      private:
+        // the number of values per item
+        int _n_components;
+        // the communicator
+        MPI_Comm _communicator;
+        // the copies held by this task, grouped by owner
+        std::vector<int> _copies;
+        // the shared items owned by this task, grouped by task holding a copy
+        std::vector<int> _shared;
+        // the values of the copies
+        std::vector<double> _copy_buffer;
+        // the values of the shared items
+        std::vector<double> _shared_buffer;
+        // the persistent requests of the update of the copies
+        std::vector<MPI_Request> _update_requests;
+        // the persistent requests of the accumulation to the owners
+        std::vector<MPI_Request> _accumulate_requests;
+    };
+}
+
+
+// end of file
@@ -0,0 +1,36 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::mesh::distributed {
+
+    // halo exchange alias
+    using halo_exchange_t = HaloExchange;
+
+    // the exchange of the {n_components} values per node of {partition}
+    template <class cellT>
+    auto node_halo(
+        const partition_t<cellT> & partition, int n_components = 1,
+        MPI_Comm communicator = MPI_COMM_WORLD) -> halo_exchange_t
+    {
+        return halo_exchange_t(
+            partition.node_ids, partition.node_owners, n_components, communicator);
+    }
+
+    // the exchange of the {n_components} values per cell of {partition}
+    template <class cellT>
+    auto cell_halo(
+        const partition_t<cellT> & partition, int n_components = 1,
+        MPI_Comm communicator = MPI_COMM_WORLD) -> halo_exchange_t
+    {
+        return halo_exchange_t(partition.cells, partition.cell_owners, n_components, communicator);
+    }
+}
+
+
+// end of file
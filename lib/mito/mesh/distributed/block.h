@@ -0,0 +1,35 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::mesh::distributed {
+
+    // a block of the cells of a mesh held by one task, in flat form: the global ids of the cells,
+    // the global ids of their nodes and the coordinates of their nodes
+    template <class cellT>
+    struct block_t {
+        // the dimension of the physical space
+        static constexpr int dim = cellT::dim;
+        // the number of nodes per cell
+        static constexpr int n_vertices = cellT::n_vertices;
+        // the total number of cells (on all tasks)
+        global_id_t n_cells = 0;
+        // the global ids of the cells of the block
+        std::vector<global_id_t> cells = {};
+        // the global ids of the nodes of the cells, {n_vertices} per cell
+        std::vector<global_id_t> connectivity = {};
+        // the coordinates of the nodes of the cells, {n_vertices * dim} per cell
+        std::vector<double> coordinates = {};
+
+        // the number of cells of the block
+        auto size() const -> int { return std::size(cells); }
+    };
+}
+
+
+// end of file
@@ -0,0 +1,280 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::mesh::distributed {
+
+    // the type of the global ids of cells and nodes
+    using global_id_t = std::int64_t;
+
+    // the MPI datatype corresponding to {T}
+    template <class T>
+    inline auto mpi_type() -> MPI_Datatype
+    {
+        if constexpr (std::is_same_v<T, int>) {
+            return MPI_INT;
+        } else if constexpr (std::is_same_v<T, std::int64_t>) {
+            return MPI_INT64_T;
+        } else if constexpr (std::is_same_v<T, std::uint64_t>) {
+            return MPI_UINT64_T;
+        } else {
+            static_assert(std::is_same_v<T, double>);
+            return MPI_DOUBLE;
+        }
+    }
+
+    // the first global id of the block of task {rank} when {n} items are distributed in contiguous
+    // blocks of (almost) equal size among {n_tasks} tasks
+    inline auto block_begin(global_id_t n, int rank, int n_tasks) -> global_id_t
+    {
+        return (n * rank) / n_tasks;
+    }
+
+    // the task whose block contains the item with global id {id}
+    inline auto block_owner(global_id_t id, global_id_t n, int n_tasks) -> int
+    {
+        // guess the owner from the average block size and correct the guess
+        int rank = static_cast<int>((id * n_tasks) / std::max<global_id_t>(n, 1));
+        while (rank > 0 && block_begin(n, rank, n_tasks) > id) {
+            --rank;
+        }
+        while (rank + 1 < n_tasks && block_begin(n, rank + 1, n_tasks) <= id) {
+            ++rank;
+        }
+
+        // all done
+        return rank;
+    }
+
+    // send the first {counts[0]} {items} to task 0, the next {counts[1]} to task 1 and so on, and
+    // return the items received from all the tasks (in order of rank) with their counts
+    template <class itemT>
+    auto alltoallv(
+        const std::vector<itemT> & items, const std::vector<int> & counts, MPI_Comm communicator)
+        -> std::pair<std::vector<itemT>, std::vector<int>>
+    {
+        // the number of tasks
+        int n_tasks = std::size(counts);
+
+        // exchange the counts
+        std::vector<int> received_counts(n_tasks, 0);
+        MPI_Alltoall(
+            counts.data(), 1, MPI_INT, received_counts.data(), 1, MPI_INT, communicator);
+
+        // the offsets of the items sent to and received from each task
+        std::vector<int> offsets(n_tasks, 0);
+        std::vector<int> received_offsets(n_tasks, 0);
+        std::exclusive_scan(std::begin(counts), std::end(counts), std::begin(offsets), 0);
+        std::exclusive_scan(
+            std::begin(received_counts), std::end(received_counts), std::begin(received_offsets),
+            0);
+
+        // exchange the items
+        std::vector<itemT> received(received_offsets.back() + received_counts.back());
+        MPI_Alltoallv(
+            items.data(), counts.data(), offsets.data(), mpi_type<itemT>(), received.data(),
+            received_counts.data(), received_offsets.data(), mpi_type<itemT>(), communicator);
+
+        // all done
+        return { std::move(received), std::move(received_counts) };
+    }
+
+    // the task keeping the directory entry of the item with global id {id}
+    inline auto directory_task(global_id_t id, int n_tasks) -> int
+    {
+        return static_cast<int>(id % n_tasks);
+    }
+
+    // the order in which items with {destinations} are sent: grouped by destination task, in
+    // their original order within each group
+    inline auto send_order(const std::vector<int> & destinations, int n_tasks)
+        -> std::pair<std::vector<int>, std::vector<int>>
+    {
+        // count the items sent to each task
+        std::vector<int> counts(n_tasks, 0);
+        for (auto task : destinations) {
+            ++counts[task];
+        }
+
+        // sort the items by destination (stably)
+        std::vector<int> offsets(n_tasks, 0);
+        std::exclusive_scan(std::begin(counts), std::end(counts), std::begin(offsets), 0);
+        std::vector<int> order(std::size(destinations));
+        for (int i = 0; i < std::ssize(destinations); ++i) {
+            order[offsets[destinations[i]]++] = i;
+        }
+
+        // all done
+        return { std::move(order), std::move(counts) };
+    }
+
+    // send the {i}-th of the {items} (each made of {width} consecutive values) to the task
+    // {destinations[i]}, and return the items received from all the tasks (in order of rank, and
+    // in the order they were sent by each task) with the task that sent each of them
+    template <class itemT>
+    auto send(
+        const std::vector<itemT> & items, int width, const std::vector<int> & destinations,
+        MPI_Comm communicator) -> std::pair<std::vector<itemT>, std::vector<int>>
+    {
+        // the number of tasks
+        int n_tasks = 0;
+        MPI_Comm_size(communicator, &n_tasks);
+
+        // the order in which the items are sent
+        auto [order, counts] = send_order(destinations, n_tasks);
+
+        // pack the items
+        std::vector<itemT> packed;
+        packed.reserve(std::size(items));
+        for (auto i : order) {
+            packed.insert(
+                std::end(packed), std::begin(items) + width * i,
+                std::begin(items) + width * (i + 1));
+        }
+        for (auto & count : counts) {
+            count *= width;
+        }
+
+        // exchange the items
+        auto [received, received_counts] = alltoallv(packed, counts, communicator);
+
+        // the task that sent each received item
+        std::vector<int> sources;
+        sources.reserve(std::size(received) / std::max(width, 1));
+        for (int task = 0; task < n_tasks; ++task) {
+            sources.insert(std::end(sources), received_counts[task] / std::max(width, 1), task);
+        }
+
+        // all done
+        return { std::move(received), std::move(sources) };
+    }
+
+    // publish the {values} of the items {ids} to the directory tasks of the items, and return
+    // the (id, value) pairs received by this task, sorted
+    inline auto publish(
+        const std::vector<global_id_t> & ids, const std::vector<global_id_t> & values,
+        MPI_Comm communicator) -> std::vector<std::pair<global_id_t, global_id_t>>
+    {
+        // the number of tasks
+        int n_tasks = 0;
+        MPI_Comm_size(communicator, &n_tasks);
+
+        // pack each id with its value, and send it to its directory task
+        std::vector<global_id_t> items;
+        std::vector<int> destinations;
+        items.reserve(2 * std::size(ids));
+        destinations.reserve(std::size(ids));
+        for (int i = 0; i < std::ssize(ids); ++i) {
+            items.push_back(ids[i]);
+            items.push_back(values[i]);
+            destinations.push_back(directory_task(ids[i], n_tasks));
+        }
+        auto received = send(items, 2, destinations, communicator).first;
+
+        // unpack and sort the received pairs
+        std::vector<std::pair<global_id_t, global_id_t>> entries(std::size(received) / 2);
+        for (int i = 0; i < std::ssize(entries); ++i) {
+            entries[i] = { received[2 * i], received[2 * i + 1] };
+        }
+        std::sort(std::begin(entries), std::end(entries));
+
+        // all done
+        return entries;
+    }
+
+    // look up the values of the items {ids} in the {directory} (the sorted (id, value) pairs kept
+    // by each task for the items it is the directory task of)
+    inline auto query(
+        const std::vector<global_id_t> & ids,
+        const std::vector<std::pair<global_id_t, global_id_t>> & directory,
+        MPI_Comm communicator) -> std::vector<global_id_t>
+    {
+        // the number of tasks
+        int n_tasks = 0;
+        MPI_Comm_size(communicator, &n_tasks);
+
+        // send each id to its directory task
+        std::vector<int> destinations(std::size(ids));
+        for (int i = 0; i < std::ssize(ids); ++i) {
+            destinations[i] = directory_task(ids[i], n_tasks);
+        }
+        auto [requests, sources] = send(ids, 1, destinations, communicator);
+
+        // answer the requests
+        std::vector<global_id_t> answers(std::size(requests));
+        for (int i = 0; i < std::ssize(requests); ++i) {
+            auto entry = std::lower_bound(
+                std::begin(directory), std::end(directory),
+                std::pair(requests[i], std::numeric_limits<global_id_t>::lowest()));
+            assert(entry != std::end(directory) && entry->first == requests[i]);
+            answers[i] = entry->second;
+        }
+
+        // send the answers back (in the order the requests were received)
+        auto received = send(answers, 1, sources, communicator).first;
+
+        // the answers come back in the order the requests were sent
+        auto order = send_order(destinations, n_tasks).first;
+        std::vector<global_id_t> values(std::size(ids));
+        for (int k = 0; k < std::ssize(order); ++k) {
+            values[order[k]] = received[k];
+        }
+
+        // all done
+        return values;
+    }
+
+    // fetch the {n_components} values of each of the items {ids} (in ascending order) from the
+    // tasks holding them, where the {n_items} items are distributed in contiguous blocks among the
+    // tasks and {values} are the values of the block of this task
+    template <class valueT>
+    auto fetch(
+        const std::vector<global_id_t> & ids, global_id_t n_items,
+        const std::vector<valueT> & values, int n_components, MPI_Comm communicator)
+        -> std::vector<valueT>
+    {
+        // the id of this task and the number of tasks
+        int task_id = 0;
+        int n_tasks = 0;
+        MPI_Comm_rank(communicator, &task_id);
+        MPI_Comm_size(communicator, &n_tasks);
+
+        // sanity check: the ids are sorted, so that the requests to each task are contiguous
+        assert(std::is_sorted(std::begin(ids), std::end(ids)));
+
+        // count the requests to each task
+        std::vector<int> counts(n_tasks, 0);
+        for (auto id : ids) {
+            ++counts[block_owner(id, n_items, n_tasks)];
+        }
+
+        // send the requests
+        auto [requests, request_counts] = alltoallv(ids, counts, communicator);
+
+        // the first item of the block of this task
+        auto first = block_begin(n_items, task_id, n_tasks);
+
+        // answer the requests
+        std::vector<valueT> answers;
+        answers.reserve(n_components * std::size(requests));
+        for (auto id : requests) {
+            auto begin = std::begin(values) + n_components * (id - first);
+            answers.insert(std::end(answers), begin, begin + n_components);
+        }
+
+        // send the answers back
+        for (auto & count : request_counts) {
+            count *= n_components;
+        }
+        // all done
+        return alltoallv(answers, request_counts, communicator).first;
+    }
+}
+
+
+// end of file
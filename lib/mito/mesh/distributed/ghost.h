@@ -0,0 +1,157 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::mesh::distributed {
+
+    // append to {partition} {n_layers} layers of ghost cells, i.e. the cells owned by other tasks
+    // that share a node with the cells of {partition} (the first layer), or with the cells of the
+    // previous layer (the following layers), and update the owners and global numbers of the nodes
+    template <class cellT, geometry::coordinates_c coordT>
+    requires(utilities::same_dim_c<cellT, coordT>)
+    auto ghost(
+        partition_t<cellT> & partition, geometry::coordinate_system_t<coordT> & coordinate_system,
+        int n_layers = 1, MPI_Comm communicator = MPI_COMM_WORLD) -> void
+    {
+        // the dimension of the physical space
+        constexpr int D = cellT::dim;
+        // the number of nodes per cell
+        constexpr int V = cellT::n_vertices;
+
+        // the id of this task
+        int task_id = 0;
+        MPI_Comm_rank(communicator, &task_id);
+
+        // the owned cells of each node of the owned cells, as sorted (node global id, cell) pairs
+        std::vector<std::pair<global_id_t, int>> node_cells;
+        node_cells.reserve(V * partition.n_owned_cells);
+        for (int e = 0; e < partition.n_owned_cells; ++e) {
+            for (int a = 0; a < V; ++a) {
+                node_cells.push_back(
+                    { partition.node_ids[partition.connectivity[V * e + a]], e });
+            }
+        }
+        utilities::parallel_sort(node_cells);
+
+        // the nodes of the owned cells, without repetitions
+        std::vector<global_id_t> provided;
+        for (const auto & entry : node_cells) {
+            if (std::empty(provided) || provided.back() != entry.first) {
+                provided.push_back(entry.first);
+            }
+        }
+
+        // append the coordinates of the nodes of cell {e} to {x}
+        auto coordinates_of = [&partition, &coordinate_system](int e, std::vector<double> & x) {
+            for (int a = 0; a < V; ++a) {
+                const auto & node = partition.nodes[partition.connectivity[V * e + a]];
+                const auto & coord = coordinate_system.coordinates(node->point());
+                for (int d = 0; d < D; ++d) {
+                    x.push_back(coord[d]);
+                }
+            }
+        };
+
+        // the cells of the current layer (the owned cells to start with)
+        int layer_begin = 0;
+        int layer_end = partition.n_owned_cells;
+
+        for (int layer = 0; layer < n_layers; ++layer) {
+            // the nodes of the current layer (the nodes whose cells are needed by this task)
+            std::vector<global_id_t> needed;
+            for (int i = V * layer_begin; i < V * layer_end; ++i) {
+                needed.push_back(partition.node_ids[partition.connectivity[i]]);
+            }
+            std::sort(std::begin(needed), std::end(needed));
+            needed.erase(std::unique(std::begin(needed), std::end(needed)), std::end(needed));
+
+            // publish the nodes provided (flagged with the task id) and needed (flagged with minus
+            // one minus the task id) by this task
+            std::vector<global_id_t> ids = provided;
+            std::vector<global_id_t> flags(std::size(provided), task_id);
+            ids.insert(std::end(ids), std::begin(needed), std::end(needed));
+            flags.insert(std::end(flags), std::size(needed), -1 - task_id);
+            auto entries = publish(ids, flags, communicator);
+
+            // for each node, ask each task providing it to send its cells to each other task
+            // needing it
+            std::vector<global_id_t> orders;
+            std::vector<int> providers;
+            for (auto first = std::begin(entries); first != std::end(entries);) {
+                // the entries of this node (the needing tasks come first)
+                auto last = std::find_if(first, std::end(entries), [first](const auto & entry) {
+                    return entry.first != first->first;
+                });
+                auto split = std::find_if(
+                    first, last, [](const auto & entry) { return entry.second >= 0; });
+                for (auto provider = split; provider != last; ++provider) {
+                    for (auto needer = first; needer != split; ++needer) {
+                        int target = -1 - needer->second;
+                        if (target != provider->second) {
+                            orders.push_back(first->first);
+                            orders.push_back(target);
+                            providers.push_back(provider->second);
+                        }
+                    }
+                }
+                first = last;
+            }
+            auto received_orders = send(orders, 2, providers, communicator).first;
+
+            // the (task, cell) pairs of the owned cells to send
+            std::vector<std::pair<int, int>> shipments;
+            for (int k = 0; k < std::ssize(received_orders) / 2; ++k) {
+                auto id = received_orders[2 * k];
+                int target = received_orders[2 * k + 1];
+                auto entry = std::lower_bound(
+                    std::begin(node_cells), std::end(node_cells),
+                    std::pair(id, std::numeric_limits<int>::min()));
+                for (; entry != std::end(node_cells) && entry->first == id; ++entry) {
+                    shipments.push_back({ target, entry->second });
+                }
+            }
+            std::sort(std::begin(shipments), std::end(shipments));
+            shipments.erase(
+                std::unique(std::begin(shipments), std::end(shipments)), std::end(shipments));
+
+            // pack the cells to send
+            std::vector<global_id_t> cell_ids;
+            std::vector<double> cell_coordinates;
+            std::vector<int> destinations;
+            for (const auto & [target, e] : shipments) {
+                cell_ids.push_back(partition.cells[e]);
+                for (int a = 0; a < V; ++a) {
+                    cell_ids.push_back(partition.node_ids[partition.connectivity[V * e + a]]);
+                }
+                coordinates_of(e, cell_coordinates);
+                destinations.push_back(target);
+            }
+
+            // send the cells
+            auto [received_ids, owners] = send(cell_ids, V + 1, destinations, communicator);
+            auto received_coordinates =
+                send(cell_coordinates, V * D, destinations, communicator).first;
+
+            // append the ghost cells of this layer
+            append_cells(partition, received_ids, received_coordinates, owners, coordinate_system);
+
+            // the next layer starts from the cells just appended
+            layer_begin = layer_end;
+            layer_end = partition.mesh.nCells();
+        }
+
+        // assign the nodes to their owners and number them globally
+        number_nodes(partition, communicator);
+
+        // all done
+        return;
+    }
+}
+
+
+// end of file
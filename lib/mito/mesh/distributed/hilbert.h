@@ -0,0 +1,71 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::mesh::distributed {
+
+    // the number of bits per coordinate of the Hilbert curve in {D} dimensions
+    template <int D>
+    constexpr int hilbert_bits = std::min(32, 64 / D);
+
+    // the index along the Hilbert curve of the point with integer coordinates {x} (each with
+    // {hilbert_bits<D>} bits), computed with Skilling's transposition algorithm
+    template <int D>
+    inline auto hilbert_index(std::array<std::uint32_t, D> x) -> std::uint64_t
+    {
+        // the number of bits per coordinate
+        constexpr int bits = hilbert_bits<D>;
+
+        // the most significant bit
+        constexpr std::uint32_t M = std::uint32_t(1) << (bits - 1);
+
+        // inverse undo excess work
+        for (std::uint32_t Q = M; Q > 1; Q >>= 1) {
+            std::uint32_t P = Q - 1;
+            for (int i = 0; i < D; ++i) {
+                if (x[i] & Q) {
+                    // invert
+                    x[0] ^= P;
+                } else {
+                    // exchange
+                    std::uint32_t t = (x[0] ^ x[i]) & P;
+                    x[0] ^= t;
+                    x[i] ^= t;
+                }
+            }
+        }
+
+        // gray encode
+        for (int i = 1; i < D; ++i) {
+            x[i] ^= x[i - 1];
+        }
+        std::uint32_t t = 0;
+        for (std::uint32_t Q = M; Q > 1; Q >>= 1) {
+            if (x[D - 1] & Q) {
+                t ^= Q - 1;
+            }
+        }
+        for (int i = 0; i < D; ++i) {
+            x[i] ^= t;
+        }
+
+        // interleave the transposed bits, most significant first
+        std::uint64_t index = 0;
+        for (int b = bits - 1; b >= 0; --b) {
+            for (int i = 0; i < D; ++i) {
+                index = (index << 1) | ((x[i] >> b) & 1);
+            }
+        }
+
+        // all done
+        return index;
+    }
+}
+
+
+// end of file
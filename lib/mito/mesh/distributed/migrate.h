@@ -0,0 +1,158 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::mesh::distributed {
+
+    // append to {partition} the cells with global ids and node global ids {ids} ({n_vertices + 1}
+    // per cell), node coordinates {coordinates} ({n_vertices * dim} per cell) and owners {owners},
+    // skipping the cells already in {partition} and reusing its nodes with the same global id
+    template <class cellT, geometry::coordinates_c coordT>
+    requires(utilities::same_dim_c<cellT, coordT>)
+    auto append_cells(
+        partition_t<cellT> & partition, const std::vector<global_id_t> & ids,
+        const std::vector<double> & coordinates, const std::vector<int> & owners,
+        geometry::coordinate_system_t<coordT> & coordinate_system) -> void
+    {
+        // the dimension of the physical space
+        constexpr int D = cellT::dim;
+        // the number of nodes per cell
+        constexpr int V = cellT::n_vertices;
+
+        // the number of cells to append
+        int n_cells = std::size(ids) / (V + 1);
+
+        // the cells already in the partition, sorted by global id
+        auto present = partition.cells;
+        std::sort(std::begin(present), std::end(present));
+
+        // the cells to append, in ascending order of global id and without repetitions
+        std::vector<int> cells;
+        for (int e = 0; e < n_cells; ++e) {
+            if (!std::binary_search(std::begin(present), std::end(present), ids[(V + 1) * e])) {
+                cells.push_back(e);
+            }
+        }
+        std::sort(std::begin(cells), std::end(cells), [&ids](int a, int b) {
+            return ids[(V + 1) * a] < ids[(V + 1) * b];
+        });
+        cells.erase(
+            std::unique(
+                std::begin(cells), std::end(cells),
+                [&ids](int a, int b) { return ids[(V + 1) * a] == ids[(V + 1) * b]; }),
+            std::end(cells));
+
+        // the nodes already in the partition, sorted by global id
+        std::vector<std::pair<global_id_t, int>> nodes(std::size(partition.nodes));
+        for (int n = 0; n < std::ssize(nodes); ++n) {
+            nodes[n] = { partition.node_ids[n], n };
+        }
+        utilities::parallel_sort(nodes);
+
+        // the global ids of the nodes of the cells to append, with their position
+        std::vector<std::pair<global_id_t, int>> entries;
+        entries.reserve(V * std::size(cells));
+        for (auto e : cells) {
+            for (int a = 0; a < V; ++a) {
+                entries.push_back({ ids[(V + 1) * e + 1 + a], V * e + a });
+            }
+        }
+        utilities::parallel_sort(entries);
+
+        // find or create the node of each entry, and record its local number
+        std::vector<int> local(V * n_cells, -1);
+        for (int i = 0; i < std::ssize(entries); ++i) {
+            auto [id, position] = entries[i];
+            // entries with the same global id share the node of the first one
+            if (i > 0 && id == entries[i - 1].first) {
+                local[position] = local[entries[i - 1].second];
+                continue;
+            }
+            // look for a node with this global id in the partition
+            auto node = std::lower_bound(
+                std::begin(nodes), std::end(nodes), std::pair(id, std::numeric_limits<int>::min()));
+            if (node != std::end(nodes) && node->first == id) {
+                local[position] = node->second;
+                continue;
+            }
+            // otherwise, create a new node
+            tensor::vector_t<D> x;
+            for (int d = 0; d < D; ++d) {
+                x[d] = coordinates[D * position + d];
+            }
+            local[position] = std::size(partition.nodes);
+            partition.node_ids.push_back(id);
+            partition.nodes.push_back(geometry::node(coordinate_system, coordT(x)));
+        }
+
+        // insert the cells in the mesh
+        for (auto e : cells) {
+            typename cellT::nodes_type cell_nodes;
+            for (int a = 0; a < V; ++a) {
+                cell_nodes[a] = partition.nodes[local[V * e + a]];
+                partition.connectivity.push_back(local[V * e + a]);
+            }
+            partition.mesh.insert(cell_nodes);
+            partition.cells.push_back(ids[(V + 1) * e]);
+            partition.cell_owners.push_back(owners[e]);
+        }
+
+        // all done
+        return;
+    }
+
+    // send each cell of {block} to the task it is painted with in {painting} and assemble the
+    // partition of this task with the cells received from all the tasks
+    template <class cellT, geometry::coordinates_c coordT>
+    requires(utilities::same_dim_c<cellT, coordT>)
+    auto migrate(
+        const block_t<cellT> & block, const std::vector<int> & painting,
+        geometry::coordinate_system_t<coordT> & coordinate_system,
+        MPI_Comm communicator = MPI_COMM_WORLD) -> partition_t<cellT>
+    {
+        // the dimension of the physical space
+        constexpr int D = cellT::dim;
+        // the number of nodes per cell
+        constexpr int V = cellT::n_vertices;
+
+        // the id of this task
+        int task_id = 0;
+        MPI_Comm_rank(communicator, &task_id);
+
+        // pack the global ids of the cells and of their nodes
+        std::vector<global_id_t> ids;
+        ids.reserve((V + 1) * block.size());
+        for (int e = 0; e < block.size(); ++e) {
+            ids.push_back(block.cells[e]);
+            ids.insert(
+                std::end(ids), std::begin(block.connectivity) + V * e,
+                std::begin(block.connectivity) + V * (e + 1));
+        }
+
+        // send the cells and the coordinates of their nodes to their destination
+        auto received_ids = send(ids, V + 1, painting, communicator).first;
+        auto received_coordinates = send(block.coordinates, V * D, painting, communicator).first;
+
+        // the partition of this task
+        partition_t<cellT> partition { mito::mesh::mesh<cellT>() };
+
+        // append the received cells, all owned by this task
+        std::vector<int> owners(std::size(received_ids) / (V + 1), task_id);
+        append_cells(partition, received_ids, received_coordinates, owners, coordinate_system);
+        partition.n_owned_cells = partition.mesh.nCells();
+
+        // assign the nodes to their owners and number them globally
+        number_nodes(partition, communicator);
+
+        // all done
+        return partition;
+    }
+}
+
+
+// end of file
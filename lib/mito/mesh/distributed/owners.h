@@ -0,0 +1,92 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::mesh::distributed {
+
+    // assign each node of {partition} to the lowest task owning a cell it belongs to, and number
+    // the nodes globally, with the nodes owned by each task numbered contiguously (in ascending
+    // order of task, and in ascending order of global id within each task)
+    template <class cellT>
+    auto number_nodes(partition_t<cellT> & partition, MPI_Comm communicator = MPI_COMM_WORLD)
+        -> void
+    {
+        // the number of nodes per cell
+        constexpr int V = cellT::n_vertices;
+
+        // the id of this task
+        int task_id = 0;
+        MPI_Comm_rank(communicator, &task_id);
+
+        // the number of nodes of the partition
+        int n_nodes = std::size(partition.nodes);
+
+        // the nodes of the cells owned by this task
+        std::vector<char> is_owned_cell_node(n_nodes, 0);
+        for (int i = 0; i < V * partition.n_owned_cells; ++i) {
+            is_owned_cell_node[partition.connectivity[i]] = 1;
+        }
+        std::vector<global_id_t> ids;
+        for (int n = 0; n < n_nodes; ++n) {
+            if (is_owned_cell_node[n]) {
+                ids.push_back(partition.node_ids[n]);
+            }
+        }
+
+        // publish them to the directory, and keep the lowest task publishing each node
+        std::vector<global_id_t> ranks(std::size(ids), task_id);
+        auto entries = publish(ids, ranks, communicator);
+        entries.erase(
+            std::unique(
+                std::begin(entries), std::end(entries),
+                [](const auto & a, const auto & b) { return a.first == b.first; }),
+            std::end(entries));
+
+        // look up the owners of all the nodes of the partition
+        auto owners = query(partition.node_ids, entries, communicator);
+        partition.node_owners.assign(std::begin(owners), std::end(owners));
+
+        // the nodes owned by this task, in ascending order of global id
+        std::vector<int> owned;
+        for (int n = 0; n < n_nodes; ++n) {
+            if (partition.node_owners[n] == task_id) {
+                owned.push_back(n);
+            }
+        }
+        std::sort(std::begin(owned), std::end(owned), [&partition](int a, int b) {
+            return partition.node_ids[a] < partition.node_ids[b];
+        });
+
+        // the first global number of the nodes owned by this task, and the total number of nodes
+        global_id_t n_owned = std::size(owned);
+        global_id_t first = 0;
+        MPI_Exscan(&n_owned, &first, 1, MPI_INT64_T, MPI_SUM, communicator);
+        if (task_id == 0) {
+            first = 0;
+        }
+        MPI_Allreduce(&n_owned, &partition.n_nodes, 1, MPI_INT64_T, MPI_SUM, communicator);
+
+        // number the owned nodes and publish their numbers to the directory
+        std::vector<global_id_t> owned_ids;
+        std::vector<global_id_t> owned_numbers;
+        for (int k = 0; k < std::ssize(owned); ++k) {
+            owned_ids.push_back(partition.node_ids[owned[k]]);
+            owned_numbers.push_back(first + k);
+        }
+        auto numbers = publish(owned_ids, owned_numbers, communicator);
+
+        // look up the numbers of all the nodes of the partition
+        partition.node_numbers = query(partition.node_ids, numbers, communicator);
+
+        // all done
+        return;
+    }
+}
+
+
+// end of file
@@ -0,0 +1,214 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::mesh::distributed {
+
+    // paint the cells of the blocks held by the tasks in {communicator} in as many partitions as
+    // tasks, by slicing the Hilbert curve through the centroids of the cells in pieces with
+    // (almost) the same number of cells
+    template <class cellT>
+    auto paint_hilbert(const block_t<cellT> & block, MPI_Comm communicator = MPI_COMM_WORLD)
+        -> std::vector<int>
+    {
+        // the dimension of the physical space
+        constexpr int D = cellT::dim;
+        // the number of nodes per cell
+        constexpr int V = cellT::n_vertices;
+
+        // the number of tasks
+        int n_tasks = 0;
+        MPI_Comm_size(communicator, &n_tasks);
+
+        // the number of cells in the block
+        int n_cells = block.size();
+
+        // the centroids of the cells
+        std::vector<double> centroids(D * n_cells, 0.0);
+        for (int e = 0; e < n_cells; ++e) {
+            for (int a = 0; a < V; ++a) {
+                for (int d = 0; d < D; ++d) {
+                    centroids[D * e + d] += block.coordinates[D * (V * e + a) + d] / V;
+                }
+            }
+        }
+
+        // the bounding box of the centroids of all the cells
+        std::array<double, D> lower;
+        std::array<double, D> upper;
+        lower.fill(std::numeric_limits<double>::max());
+        upper.fill(std::numeric_limits<double>::lowest());
+        for (int e = 0; e < n_cells; ++e) {
+            for (int d = 0; d < D; ++d) {
+                lower[d] = std::min(lower[d], centroids[D * e + d]);
+                upper[d] = std::max(upper[d], centroids[D * e + d]);
+            }
+        }
+        MPI_Allreduce(MPI_IN_PLACE, lower.data(), D, MPI_DOUBLE, MPI_MIN, communicator);
+        MPI_Allreduce(MPI_IN_PLACE, upper.data(), D, MPI_DOUBLE, MPI_MAX, communicator);
+
+        // the position of the centroid of each cell along the Hilbert curve
+        constexpr double n_boxes = double(std::uint64_t(1) << hilbert_bits<D>);
+        std::vector<std::uint64_t> keys(n_cells);
+        for (int e = 0; e < n_cells; ++e) {
+            std::array<std::uint32_t, D> x;
+            for (int d = 0; d < D; ++d) {
+                double extent = std::max(upper[d] - lower[d], std::numeric_limits<double>::min());
+                double s = (centroids[D * e + d] - lower[d]) / extent;
+                x[d] = static_cast<std::uint32_t>(std::min(s * n_boxes, n_boxes - 1));
+            }
+            keys[e] = hilbert_index<D>(x);
+        }
+
+        // sample the sorted keys regularly, each sample standing for the same share of the cells
+        // of this block
+        auto sorted = keys;
+        std::sort(std::begin(sorted), std::end(sorted));
+        int n_samples = std::min(n_cells, 64 * n_tasks);
+        std::vector<std::uint64_t> samples(n_samples);
+        std::vector<double> weights(n_samples, double(n_cells) / std::max(n_samples, 1));
+        for (int s = 0; s < n_samples; ++s) {
+            samples[s] = sorted[(1L * s * n_cells) / n_samples];
+        }
+
+        // gather the samples of all the tasks
+        std::vector<int> counts(n_tasks, 0);
+        MPI_Allgather(&n_samples, 1, MPI_INT, counts.data(), 1, MPI_INT, communicator);
+        std::vector<int> offsets(n_tasks, 0);
+        std::exclusive_scan(std::begin(counts), std::end(counts), std::begin(offsets), 0);
+        int n_all_samples = offsets.back() + counts.back();
+        std::vector<std::uint64_t> all_samples(n_all_samples);
+        std::vector<double> all_weights(n_all_samples);
+        MPI_Allgatherv(
+            samples.data(), n_samples, MPI_UINT64_T, all_samples.data(), counts.data(),
+            offsets.data(), MPI_UINT64_T, communicator);
+        MPI_Allgatherv(
+            weights.data(), n_samples, MPI_DOUBLE, all_weights.data(), counts.data(),
+            offsets.data(), MPI_DOUBLE, communicator);
+
+        // sort the samples along the curve
+        std::vector<int> order(n_all_samples);
+        std::iota(std::begin(order), std::end(order), 0);
+        std::sort(std::begin(order), std::end(order), [&all_samples](int a, int b) {
+            return all_samples[a] < all_samples[b];
+        });
+
+        // the total weight of the samples
+        double total = std::accumulate(std::begin(all_weights), std::end(all_weights), 0.0);
+
+        // choose the splitters between partitions at equal shares of the total weight
+        std::vector<std::uint64_t> splitters;
+        double cumulated = 0.0;
+        for (auto s : order) {
+            if (std::ssize(splitters) == n_tasks - 1) {
+                break;
+            }
+            cumulated += all_weights[s];
+            while (std::ssize(splitters) < n_tasks - 1
+                   && cumulated > total * (std::size(splitters) + 1) / n_tasks) {
+                splitters.push_back(all_samples[s]);
+            }
+        }
+        splitters.resize(n_tasks - 1, std::numeric_limits<std::uint64_t>::max());
+
+        // paint each cell with the piece of curve its centroid falls in
+        std::vector<int> painting(n_cells);
+        for (int e = 0; e < n_cells; ++e) {
+            painting[e] =
+                std::lower_bound(std::begin(splitters), std::end(splitters), keys[e])
+                - std::begin(splitters);
+        }
+
+        // all done
+        return painting;
+    }
+
+#ifdef WITH_PARMETIS
+    // paint the cells of the blocks held by the tasks in {communicator} in as many partitions as
+    // tasks with ParMETIS
+    // Note that ParMETIS requires every task to hold at least one cell
+    template <class cellT>
+    auto paint_parmetis(const block_t<cellT> & block, MPI_Comm communicator = MPI_COMM_WORLD)
+        -> std::vector<int>
+    {
+        // the number of nodes per cell
+        constexpr int V = cellT::n_vertices;
+
+        // the number of tasks
+        int n_tasks = 0;
+        MPI_Comm_size(communicator, &n_tasks);
+
+        // the number of cells in the block
+        idx_t n_cells = block.size();
+
+        // the distribution of the cells among the tasks
+        std::vector<idx_t> element_distribution(n_tasks + 1, 0);
+        MPI_Allgather(
+            &n_cells, 1, mpi_type<idx_t>(), element_distribution.data() + 1, 1, mpi_type<idx_t>(),
+            communicator);
+        std::partial_sum(
+            std::begin(element_distribution), std::end(element_distribution),
+            std::begin(element_distribution));
+
+        // the connectivity of the cells in the block
+        std::vector<idx_t> element_index(n_cells + 1);
+        for (idx_t e = 0; e <= n_cells; ++e) {
+            element_index[e] = V * e;
+        }
+        std::vector<idx_t> element_connectivity(
+            std::begin(block.connectivity), std::end(block.connectivity));
+
+        // cells sharing a face are adjacent
+        idx_t n_common = cellT::order;
+
+        // unweighted cells, zero-based numbering, one balance constraint
+        idx_t weight_flag = 0;
+        idx_t numbering = 0;
+        idx_t n_constraints = 1;
+        idx_t n_partitions = n_tasks;
+
+        // partitions of equal size with 5% imbalance tolerance
+        std::vector<real_t> target_weights(n_partitions, real_t(1) / n_partitions);
+        real_t imbalance = 1.05;
+
+        // default options
+        idx_t options[3] = { 0, 0, 0 };
+
+        // the edgecut and the painting
+        idx_t edgecut = 0;
+        std::vector<idx_t> painting(n_cells, 0);
+
+        [[maybe_unused]] int result = ParMETIS_V3_PartMeshKway(
+            element_distribution.data(), element_index.data(), element_connectivity.data(), NULL,
+            &weight_flag, &numbering, &n_constraints, &n_common, &n_partitions,
+            target_weights.data(), &imbalance, options, &edgecut, painting.data(), &communicator);
+
+        // assert that parmetis ran correctly
+        assert(result == METIS_OK);
+
+        // all done
+        return std::vector<int>(std::begin(painting), std::end(painting));
+    }
+#endif
+
+    // paint the cells of the blocks held by the tasks in {communicator} in as many partitions as
+    // tasks (with ParMETIS, if available, or along a Hilbert curve otherwise)
+    template <class cellT>
+    auto paint(const block_t<cellT> & block, MPI_Comm communicator = MPI_COMM_WORLD)
+        -> std::vector<int>
+    {
+#ifdef WITH_PARMETIS
+        return paint_parmetis(block, communicator);
+#else
+        return paint_hilbert(block, communicator);
+#endif
+    }
+}
+
+
+// end of file
@@ -0,0 +1,43 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::mesh::distributed {
+
+    // the partition of a distributed mesh held by one task: the mesh of the cells it owns
+    // (followed by its ghost cells, if any), and the global ids and owners of its cells and nodes
+    template <class cellT>
+    struct partition_t {
+        // the type of node
+        using node_type = typename cellT::node_type;
+        // the mesh of the cells of the partition (owned cells first, then ghost cells)
+        mesh_t<cellT> mesh;
+        // the number of cells owned by this task
+        int n_owned_cells = 0;
+        // the global ids of the cells, in the order of iteration on the mesh
+        std::vector<global_id_t> cells = {};
+        // the task owning each cell
+        std::vector<int> cell_owners = {};
+        // the local numbers of the nodes of the cells, {n_vertices} per cell
+        std::vector<int> connectivity = {};
+        // the nodes of the partition
+        std::vector<node_type> nodes = {};
+        // the global ids of the nodes
+        std::vector<global_id_t> node_ids = {};
+        // the task owning each node
+        std::vector<int> node_owners = {};
+        // the global number of each node (the nodes owned by each task are numbered contiguously,
+        // in ascending order of task)
+        std::vector<global_id_t> node_numbers = {};
+        // the total number of nodes (on all tasks)
+        global_id_t n_nodes = 0;
+    };
+}
+
+
+// end of file
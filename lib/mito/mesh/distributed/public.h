@@ -0,0 +1,44 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+// external packages
+#include "externals.h"
+
+// communication of items distributed among the tasks
+#include "exchange.h"
+
+// blocks of cells held by each task
+#include "block.h"
+
+// partitions of a distributed mesh
+#include "partition.h"
+
+// Hilbert space-filling curve
+#include "hilbert.h"
+
+// distributed partitioning
+#include "paint.h"
+
+// owners and global numbering of the nodes
+#include "owners.h"
+
+// migration of the cells to their partition
+#include "migrate.h"
+
+// ghost layers
+#include "ghost.h"
+
+// exchange of values between owners and copies
+#include "HaloExchange.h"
+
+// published types and functions
+#include "api.h"
+
+
+// end of file
@@ -7,8 +7,16 @@
 #pragma once
 
 // externals
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <numeric>
 #include <ranges>
+#include <span>
+#include <stdexcept>
 #include <unordered_map>
+#include <vector>
 
 // support
 #include "../journal.h"
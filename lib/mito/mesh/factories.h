@@ -16,6 +16,41 @@ namespace mito::mesh {
         return mesh_t<cellT>();
     }
 
+    // mesh factory (with {segment_size} cells stored per memory segment)
+    template <class cellT>
+    auto mesh(int segment_size) -> mesh_t<cellT>
+    {
+        return mesh_t<cellT>(segment_size);
+    }
+
+    // dense numbering of the nodes of {mesh}, where nodes with the same {key} share a number
+    template <mesh_c meshT, class keyFunctionT>
+    auto numbering(const meshT & mesh, keyFunctionT key) -> numbering_t<meshT>
+    {
+        return numbering_t<meshT>(mesh, key);
+    }
+
+    // dense numbering of the nodes of {mesh}, where nodes sharing a vertex share a number
+    template <mesh_c meshT>
+    auto vertex_numbering(const meshT & mesh) -> numbering_t<meshT>
+    {
+        return numbering(mesh, [](const auto & node) { return node->vertex().id(); });
+    }
+
+    // dense numbering of the nodes of {mesh}, where nodes sharing a point share a number
+    template <mesh_c meshT>
+    auto point_numbering(const meshT & mesh) -> numbering_t<meshT>
+    {
+        return numbering(mesh, [](const auto & node) { return node->point().id(); });
+    }
+
+    // dense numbering of the nodes of {mesh}, where each node has its own number
+    template <mesh_c meshT>
+    auto node_numbering(const meshT & mesh) -> numbering_t<meshT>
+    {
+        return numbering(mesh, [](const auto & node) { return node.id(); });
+    }
+
 }
 
 
@@ -32,6 +32,14 @@ namespace mito::mesh {
     // class filter
     template <class meshT, int I>
     class Filter;
+
+    // class numbering
+    template <class meshT>
+    class Numbering;
+
+    // numbering alias
+    template <class meshT>
+    using numbering_t = Numbering<meshT>;
 }
 
 
@@ -0,0 +1,147 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::mesh::generators {
+
+    // build the Freudenthal (Kuhn) triangulation of the box [{lower}, {upper}] subdivided in
+    // {n[0]} x ... x {n[D-1]} boxes, each split in D! simplices
+    // If {n_slabs} > 1, only the {slab}-th of {n_slabs} slabs of boxes along the last axis is
+    // generated (e.g. the slab of the current MPI task)
+    template <int D, geometry::coordinates_c coordT>
+    requires(coordT::dim == D)
+    auto kuhn(
+        geometry::coordinate_system_t<coordT> & coordinate_system, const std::array<int, D> & n,
+        const coordT & lower, const coordT & upper, int n_slabs = 1, int slab = 0)
+        -> mesh_t<geometry::geometric_simplex_t<D, D>>
+    {
+        // the cell type
+        using cell_type = geometry::geometric_simplex_t<D, D>;
+        // the node type
+        using node_type = geometry::node_t<D>;
+
+        // sanity check
+        assert(n_slabs > 0 && slab >= 0 && slab < n_slabs);
+
+        // the range of boxes of this slab along the last axis
+        int first = (n[D - 1] * slab) / n_slabs;
+        int last = (n[D - 1] * (slab + 1)) / n_slabs;
+
+        // the number of nodes per axis in this slab and the strides of the node numbering
+        std::array<int, D> n_nodes;
+        std::array<int, D> strides;
+        int total_nodes = 1;
+        int total_boxes = 1;
+        for (int d = 0; d < D; ++d) {
+            n_nodes[d] = (d == D - 1 ? last - first : n[d]) + 1;
+            strides[d] = total_nodes;
+            total_nodes *= n_nodes[d];
+            total_boxes *= n_nodes[d] - 1;
+        }
+
+        // the simplices of the unit box: each simplex is a path from the corner 0 to the opposite
+        // corner moving along the axes in the order given by a permutation of the axes
+        // (corners are encoded as bitmasks of the axes)
+        std::vector<std::array<int, D + 1>> simplices;
+        std::array<int, D> axes;
+        std::iota(std::begin(axes), std::end(axes), 0);
+        do {
+            // walk along the path
+            std::array<int, D + 1> corners;
+            corners[0] = 0;
+            for (int d = 0; d < D; ++d) {
+                corners[d + 1] = corners[d] | (1 << axes[d]);
+            }
+            // the orientation of the simplex is the sign of the permutation: fix odd ones by
+            // swapping the last two corners
+            int inversions = 0;
+            for (int a = 0; a < D; ++a) {
+                for (int b = a + 1; b < D; ++b) {
+                    inversions += (axes[a] > axes[b]);
+                }
+            }
+            if (inversions % 2 == 1) {
+                std::swap(corners[D - 1], corners[D]);
+            }
+            simplices.push_back(corners);
+        } while (std::next_permutation(std::begin(axes), std::end(axes)));
+
+        // create all the nodes of the slab at once
+        std::vector<node_type> nodes;
+        nodes.reserve(total_nodes);
+        for (int node = 0; node < total_nodes; ++node) {
+            // the position of the node on the grid and the corresponding coordinates
+            tensor::vector_t<D> x;
+            for (int d = 0; d < D; ++d) {
+                int i = (node / strides[d]) % n_nodes[d] + (d == D - 1 ? first : 0);
+                x[d] = lower[d] + ((upper[d] - lower[d]) * i) / n[d];
+            }
+            nodes.push_back(geometry::node(coordinate_system, coordT(x)));
+        }
+
+        // an empty mesh with memory segments large enough to avoid tiny allocations
+        auto mesh = mito::mesh::mesh<cell_type>(std::clamp(total_boxes, 100, 1 << 16));
+
+        // the nodes of the simplices of each box
+        std::vector<int> connectivity;
+        connectivity.reserve(std::size(simplices) * total_boxes * (D + 1));
+        for (int box = 0; box < total_boxes; ++box) {
+            // the node at the lower corner of the box
+            int origin = 0;
+            int index = box;
+            for (int d = 0; d < D; ++d) {
+                origin += (index % (n_nodes[d] - 1)) * strides[d];
+                index /= n_nodes[d] - 1;
+            }
+
+            // the nodes of the simplices of the box
+            for (const auto & corners : simplices) {
+                for (int a = 0; a < D + 1; ++a) {
+                    int offset = 0;
+                    for (int d = 0; d < D; ++d) {
+                        offset += ((corners[a] >> d) & 1) * strides[d];
+                    }
+                    connectivity.push_back(origin + offset);
+                }
+            }
+        }
+
+        // insert the simplices of all the boxes at once
+        mesh.insert(nodes, connectivity);
+
+        // all done
+        return mesh;
+    }
+
+    // build a mesh of the rectangle [{lower}, {upper}] with {n} x {m} squares, each split in two
+    // triangles (optionally only the {slab}-th of {n_slabs} slabs of rows)
+    template <geometry::coordinates_c coordT>
+    requires(coordT::dim == 2)
+    auto rectangle(
+        geometry::coordinate_system_t<coordT> & coordinate_system, int n, int m,
+        const coordT & lower, const coordT & upper, int n_slabs = 1, int slab = 0)
+        -> mesh_t<geometry::triangle_t<2>>
+    {
+        return kuhn<2>(coordinate_system, { n, m }, lower, upper, n_slabs, slab);
+    }
+
+    // build a mesh of the box [{lower}, {upper}] with {n} x {m} x {k} cubes, each split in six
+    // tetrahedra (optionally only the {slab}-th of {n_slabs} slabs of layers)
+    template <geometry::coordinates_c coordT>
+    requires(coordT::dim == 3)
+    auto box(
+        geometry::coordinate_system_t<coordT> & coordinate_system, int n, int m, int k,
+        const coordT & lower, const coordT & upper, int n_slabs = 1, int slab = 0)
+        -> mesh_t<geometry::tetrahedron_t<3>>
+    {
+        return kuhn<3>(coordinate_system, { n, m, k }, lower, upper, n_slabs, slab);
+    }
+}
+
+
+// end of file
@@ -17,26 +17,47 @@ namespace mito::mesh::metis {
         using mesh_type = meshT;
         // typedef cell type
         using cell_type = typename mesh_type::cell_type;
-        // typedef vertex type
-        using vertex_type = topology::vertex_t;
         // typedef node type
         using node_type = typename mesh_type::node_type;
 
       private:
-        // populate a map between vertices and a continuous integer id = 0, ..., n_vertices - 1
-        static inline auto _populate_vertices_map(const mesh_type & mesh) -> auto;
-        // populate elements connectivity
-        static inline auto _populate_element_connectivity(
-            const auto & cells, const auto & vertex_to_id) -> auto;
         // paint metis partition
         static inline auto _metis_paint_partition(
-            std::vector<int> & element_connectivity, int n_vertices, int n_elements,
+            const std::vector<int> & element_connectivity, int n_vertices, int n_elements,
             int n_partitions) -> auto;
+        // paint metis partition of the dual graph of the elements subject to {constraints}
+        static inline auto _metis_paint_constrained_partition(
+            const std::vector<int> & element_connectivity, int n_vertices, int n_elements,
+            int n_partitions, const constraints_t & constraints) -> painting_t;
         // return a partitioned mesh with the painted partition
         static inline auto _create_partitioned_mesh(
             const auto & cells, const auto & painting, int n_rank) -> mesh_type;
+        // return all the partitioned meshes with the painted partition
+        static inline auto _create_partitioned_meshes(
+            const auto & cells, const auto & painting, int n_partitions)
+            -> std::vector<mesh_type>;
 
       public:
+        // paint partition and return the partition of each cell of {mesh} (in the order of
+        // iteration on the cells)
+        static inline auto paint(const mesh_type & mesh, int n_partitions) -> std::vector<int>;
+
+        // paint partition balancing the cell weights in {constraints} and return the partition
+        // of each cell of {mesh}, the edgecut and the load of each partition
+        static inline auto paint(
+            const mesh_type & mesh, int n_partitions, const constraints_t & constraints)
+            -> painting_t;
+
+        // paint partition and return all the {n_partitions} partitions
+        static inline auto partition(const mesh_type & mesh, int n_partitions)
+            -> std::vector<mesh_type>;
+
+        // paint partition balancing the cell weights in {constraints} and return all the
+        // {n_partitions} partitions
+        static inline auto partition(
+            const mesh_type & mesh, int n_partitions, const constraints_t & constraints)
+            -> std::vector<mesh_type>;
+
         // paint partition and return the partition corresponding to {n_rank}
         static inline auto partition(const mesh_type & mesh, int n_partitions, int n_rank)
             -> mesh_type;
@@ -9,6 +9,32 @@
 
 namespace mito::mesh::metis {
 
+    template <class meshT>
+    auto paint(const meshT & mesh, int n_partitions) -> std::vector<int>
+    {
+        return Partitioner<meshT>::paint(mesh, n_partitions);
+    }
+
+    template <class meshT>
+    auto paint(const meshT & mesh, int n_partitions, const constraints_t & constraints)
+        -> painting_t
+    {
+        return Partitioner<meshT>::paint(mesh, n_partitions, constraints);
+    }
+
+    template <class meshT>
+    auto partition(const meshT & mesh, int n_partitions) -> std::vector<meshT>
+    {
+        return Partitioner<meshT>::partition(mesh, n_partitions);
+    }
+
+    template <class meshT>
+    auto partition(const meshT & mesh, int n_partitions, const constraints_t & constraints)
+        -> std::vector<meshT>
+    {
+        return Partitioner<meshT>::partition(mesh, n_partitions, constraints);
+    }
+
     template <class meshT>
     auto partition(const meshT & mesh, int n_partitions, int n_rank) -> meshT
     {
@@ -0,0 +1,90 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::mesh::metis {
+
+    // the balance constraints of a partition
+    struct constraints_t {
+        // the number of balance constraints (i.e. of weights per cell)
+        int n_constraints = 1;
+        // the weights of the cells, {n_constraints} per cell in the order of iteration on the
+        // cells (unit weights, if empty)
+        std::vector<int> weights = {};
+        // the communication sizes of the cells in the order of iteration on the cells (if not
+        // empty, the total communication volume is minimized instead of the edgecut)
+        std::vector<int> sizes = {};
+        // the load imbalance tolerated for each constraint (maximum over average part load)
+        double imbalance = 1.03;
+    };
+
+    // the result of a constrained partition
+    struct painting_t {
+        // the partition of each cell in the order of iteration on the cells
+        std::vector<int> parts;
+        // the number of faces of the mesh shared by cells in different partitions
+        int edgecut = 0;
+        // the load of each partition, {n_constraints} per partition
+        std::vector<int> loads;
+    };
+
+    // the constraints balancing the weights {weight(cell)} of the cells of {mesh}, where
+    // {weight(cell)} is either an integer or an array of integers (one per constraint)
+    template <mesh_c meshT, class weightT>
+    auto constraints(const meshT & mesh, weightT && weight, double imbalance = 1.03)
+        -> constraints_t
+    {
+        // the type of the weight of a cell
+        using weight_type = std::invoke_result_t<weightT, const typename meshT::cell_type &>;
+
+        // the constraints
+        constraints_t result;
+        result.imbalance = imbalance;
+
+        // collect the weights of the cells
+        result.weights.reserve(mesh.nCells());
+        for (const auto & cell : mesh.cells()) {
+            if constexpr (std::is_integral_v<weight_type>) {
+                result.weights.push_back(weight(cell));
+            } else {
+                const auto & weights = weight(cell);
+                result.n_constraints = std::size(weights);
+                result.weights.insert(
+                    std::end(result.weights), std::begin(weights), std::end(weights));
+            }
+        }
+
+        // all done
+        return result;
+    }
+
+    // the constraints balancing the weights {weight(cell)} of the cells of {mesh} and minimizing
+    // the communication volume, with the communication size of each cell given by {size(cell)}
+    // (only if {size} is callable on a cell, so that a number passed as {imbalance} is not taken
+    // for {size})
+    template <mesh_c meshT, class weightT, class sizeT>
+    requires(std::invocable<sizeT, const typename meshT::cell_type &>)
+    auto constraints(const meshT & mesh, weightT && weight, sizeT && size, double imbalance = 1.03)
+        -> constraints_t
+    {
+        // the weight constraints
+        auto result = constraints(mesh, std::forward<weightT>(weight), imbalance);
+
+        // collect the communication sizes of the cells
+        result.sizes.reserve(mesh.nCells());
+        for (const auto & cell : mesh.cells()) {
+            result.sizes.push_back(size(cell));
+        }
+
+        // all done
+        return result;
+    }
+}
+
+
+// end of file
@@ -8,7 +8,16 @@
 
 
 // externals
+#include <cmath>
+#include <concepts>
 #include <metis.h>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#ifdef WITH_MPI
+#include <mpi.h>
+#endif
 
 
 // end of file
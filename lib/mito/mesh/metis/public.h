@@ -10,11 +10,19 @@
 // external packages
 #include "externals.h"
 
+// balance constraints of the partitions
+#include "constraints.h"
+
 // support for mesh partitioning
 #include "Partitioner.h"
 
 // published types and functions
 #include "api.h"
 
+// distribution of the partitions to the MPI tasks
+#ifdef WITH_MPI
+#include "scatter.h"
+#endif
+
 
 // end of file
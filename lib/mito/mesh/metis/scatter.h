@@ -0,0 +1,173 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::mesh::metis {
+
+    // partition {mesh} once on task {root} in as many partitions as the tasks in {communicator}
+    // and send each task only the cells of its partition and the coordinates of their nodes
+    // Note that {mesh} is only read on task {root}, where the returned partition shares the nodes
+    // of {mesh}; on the other tasks, the nodes are created anew in {coordinate_system}
+    template <class cellT, geometry::coordinates_c coordT>
+    requires(utilities::same_dim_c<cellT, coordT>)
+    auto scatter(
+        const mesh_t<cellT> & mesh, geometry::coordinate_system_t<coordT> & coordinate_system,
+        int root = 0, MPI_Comm communicator = MPI_COMM_WORLD) -> mesh_t<cellT>
+    {
+        // the number of vertices per cell
+        constexpr int V = cellT::n_vertices;
+        // the dimension of the physical space
+        constexpr int D = cellT::dim;
+        // the node type
+        using node_type = typename cellT::node_type;
+
+        // the id of this task and the number of tasks
+        int task_id = 0;
+        int n_tasks = 0;
+        MPI_Comm_rank(communicator, &task_id);
+        MPI_Comm_size(communicator, &n_tasks);
+
+        // the cells of each partition (only populated on task {root})
+        std::vector<std::vector<const cellT *>> partitions(n_tasks);
+
+        // the number of cells, the number of nodes, the connectivity and the node coordinates of
+        // each partition but the root's, packed one partition after the other
+        std::vector<int> cell_counts(n_tasks, 0);
+        std::vector<int> node_counts(n_tasks, 0);
+        std::vector<int> connectivity;
+        std::vector<double> coordinates;
+
+        // on task {root}, paint the partition once and pack the cells of each partition
+        if (task_id == root) {
+            // paint the partition
+            auto painting = paint(mesh, n_tasks);
+
+            // a dense numbering of the nodes of the mesh
+            auto numbering = mito::mesh::node_numbering(mesh);
+
+            // sort the cells by partition
+            std::vector<std::vector<int>> partition_cells(n_tasks);
+            int e = 0;
+            for (const auto & cell : mesh.cells()) {
+                partitions[painting[e]].push_back(&cell);
+                partition_cells[painting[e]].push_back(e);
+                ++e;
+            }
+
+            // the local number of each node in the partition being packed
+            std::vector<int> local(numbering.size(), -1);
+
+            // pack the cells of each partition numbering their nodes locally
+            for (int task = 0; task < n_tasks; ++task) {
+                // the root keeps its own cells
+                if (task == root) {
+                    continue;
+                }
+
+                // the number of nodes of this partition
+                int n_local = 0;
+                for (auto cell : partition_cells[task]) {
+                    for (int a = 0; a < V; ++a) {
+                        int n = numbering(cell, a);
+                        if (local[n] == -1) {
+                            local[n] = n_local++;
+                            const auto & point = numbering.node(n)->point();
+                            const auto & coord = coordinate_system.coordinates(point);
+                            for (int d = 0; d < D; ++d) {
+                                coordinates.push_back(coord[d]);
+                            }
+                        }
+                        connectivity.push_back(local[n]);
+                    }
+                }
+
+                // reset the local numbers for the next partition
+                for (auto cell : partition_cells[task]) {
+                    for (int a = 0; a < V; ++a) {
+                        local[numbering(cell, a)] = -1;
+                    }
+                }
+
+                // record the size of this partition
+                cell_counts[task] = std::size(partition_cells[task]);
+                node_counts[task] = n_local;
+            }
+        }
+
+        // send each task the size of its partition
+        int n_cells = 0;
+        int n_nodes = 0;
+        MPI_Scatter(cell_counts.data(), 1, MPI_INT, &n_cells, 1, MPI_INT, root, communicator);
+        MPI_Scatter(node_counts.data(), 1, MPI_INT, &n_nodes, 1, MPI_INT, root, communicator);
+
+        // the sizes and offsets of the packed connectivity and coordinates of each partition
+        std::vector<int> connectivity_counts(n_tasks, 0);
+        std::vector<int> connectivity_offsets(n_tasks, 0);
+        std::vector<int> coordinates_counts(n_tasks, 0);
+        std::vector<int> coordinates_offsets(n_tasks, 0);
+        for (int task = 0; task < n_tasks; ++task) {
+            connectivity_counts[task] = V * cell_counts[task];
+            coordinates_counts[task] = D * node_counts[task];
+            if (task > 0) {
+                connectivity_offsets[task] =
+                    connectivity_offsets[task - 1] + connectivity_counts[task - 1];
+                coordinates_offsets[task] =
+                    coordinates_offsets[task - 1] + coordinates_counts[task - 1];
+            }
+        }
+
+        // send each task its connectivity and node coordinates
+        std::vector<int> local_connectivity(V * n_cells);
+        std::vector<double> local_coordinates(D * n_nodes);
+        MPI_Scatterv(
+            connectivity.data(), connectivity_counts.data(), connectivity_offsets.data(), MPI_INT,
+            local_connectivity.data(), V * n_cells, MPI_INT, root, communicator);
+        MPI_Scatterv(
+            coordinates.data(), coordinates_counts.data(), coordinates_offsets.data(), MPI_DOUBLE,
+            local_coordinates.data(), D * n_nodes, MPI_DOUBLE, root, communicator);
+
+        // an empty mesh for the partition of this task
+        auto partition = mito::mesh::mesh<cellT>();
+
+        // on task {root}, insert the cells of the root partition
+        if (task_id == root) {
+            for (const auto * cell : partitions[root]) {
+                partition.insert(*cell);
+            }
+
+            // all done
+            return partition;
+        }
+
+        // on the other tasks, create the nodes...
+        std::vector<node_type> nodes;
+        nodes.reserve(n_nodes);
+        for (int n = 0; n < n_nodes; ++n) {
+            tensor::vector_t<D> x;
+            for (int d = 0; d < D; ++d) {
+                x[d] = local_coordinates[D * n + d];
+            }
+            nodes.push_back(geometry::node(coordinate_system, coordT(x)));
+        }
+
+        // ... and the cells
+        for (int e = 0; e < n_cells; ++e) {
+            typename cellT::nodes_type cell_nodes;
+            for (int a = 0; a < V; ++a) {
+                cell_nodes[a] = nodes[local_connectivity[V * e + a]];
+            }
+            partition.insert(cell_nodes);
+        }
+
+        // all done
+        return partition;
+    }
+}
+
+
+// end of file
@@ -17,7 +17,9 @@
 #include "api.h"
 
 // classes implementation
+#include "OrientationMap.h"
 #include "Mesh.h"
+#include "Numbering.h"
 #include "Boundary.h"
 #include "Filter.h"
 
@@ -27,9 +29,20 @@
 // mesh utilities
 #include "utilities.h"
 
+// mesh generators
+#include "generators.h"
+
+// local refinement
+#include "bisection.h"
+
 #ifdef WITH_METIS
 #include "metis/public.h"
 #endif
 
+// distributed meshes
+#ifdef WITH_MPI
+#include "distributed/public.h"
+#endif
+
 
 // end of file
@@ -23,6 +23,7 @@
 #include "math.h"
 #include "mesh.h"
 #include "quadrature.h"
+#include "search.h"
 #include "simulation.h"
 #include "topology.h"
 #include "utilities.h"
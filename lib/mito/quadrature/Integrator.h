@@ -28,21 +28,26 @@ namespace mito::quadrature {
         static constexpr auto _quadratureRule = quadrature_rule_type();
         // the number of quadrature points
         static constexpr int Q = quadrature_rule_type::npoints;
-        // the quadrature field type to store the coordinates of the quadrature points
-        using quadrature_field_type = discrete::quadrature_field_t<cell_type, Q, coordinates_type>;
+        // the storage of the coordinates of the quadrature points, laid out as [element][point]
+        using quadrature_points_type = utilities::aligned_vector_t<coordinates_type>;
 
       private:
         template <int... q>
         auto _computeQuadPointCoordinates(tensor::integer_sequence<q...>) -> void
         {
-            // loop on elements
+            // loop on elements (numbered by their position in the iteration on the elements, so
+            // that elements repeating a cell get a row each)
+            int e = 0;
             for (const auto & element : _manifold.elements()) {
                 // get element parametrization under the manifold's coordinate system
                 const auto parametrization = element.parametrization(_manifold.coordinate_system());
                 // populate the field with the coordinates of the quadrature points in physical
                 // space
-                _coordinates.insert(
-                    element.simplex(), { parametrization(_quadratureRule.point(q))... });
+                ((_coordinates[Q * e + q] = parametrization(_quadratureRule.point(q))), ...);
+                // record the volume of the element
+                _volumes[e] = _manifold.volume(element);
+                // next element
+                ++e;
             }
 
             // all done
@@ -52,7 +57,8 @@ namespace mito::quadrature {
       public:
         Integrator(const manifold_type & manifold) :
             _manifold(manifold),
-            _coordinates("coordinates")
+            _coordinates(Q * manifold.nElements()),
+            _volumes(manifold.nElements())
         {
             _computeQuadPointCoordinates(tensor::make_integer_sequence<Q>{});
         }
@@ -60,22 +66,32 @@ namespace mito::quadrature {
         auto integrate(const fields::scalar_field_c auto & f) const -> tensor::scalar_t
         {
             auto result = tensor::scalar_t{ 0.0 };
-            // assemble elementary contributions
-            for (const auto & cell : _manifold.elements()) {
+            // assemble elementary contributions, streaming through the quadrature points of the
+            // elements in the order of their numbers
+            for (auto e = 0; e < std::ssize(_volumes); ++e) {
                 for (auto q = 0; q < Q; ++q) {
-                    auto point = _coordinates(cell.simplex())[q];
-                    result += f(point) * _quadratureRule.weight(q) * _manifold.volume(cell);
+                    const auto & point = _coordinates[Q * e + q];
+                    result += f(point) * _quadratureRule.weight(q) * _volumes[e];
                 }
             }
 
             return result;
         }
 
+        // accessor for the coordinates of the quadrature points, laid out as [element][point] in
+        // the order of iteration on the elements
+        auto coordinates() const noexcept -> std::span<const coordinates_type>
+        {
+            return _coordinates;
+        }
+
       private:
         // the domain of integration
         const manifold_type & _manifold;
         // the coordinates of the quadrature points in the domain of integration
-        quadrature_field_type _coordinates;
+        quadrature_points_type _coordinates;
+        // the volumes of the elements, in the order of iteration on the elements
+        utilities::aligned_vector_t<tensor::scalar_t> _volumes;
     };
 
 }    // namespace  mito
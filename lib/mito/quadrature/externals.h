@@ -8,6 +8,7 @@
 
 
 // externals
+#include <span>
 
 // support
 #include "../journal.h"
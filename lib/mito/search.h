@@ -0,0 +1,15 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+// publish the interface
+// the api is in "search/api.h"
+#include "search/public.h"
+
+
+// end of file
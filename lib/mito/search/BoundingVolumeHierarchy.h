@@ -0,0 +1,441 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+/*
+ * This class represents a bounding volume hierarchy of axis-aligned boxes over the cells of a
+ * mesh, for point location queries.
+ *
+ * The hierarchy is built in O(n log n) by recursively splitting the cells at the median of their
+ * centroids along the longest axis of the enclosing box. The vertex coordinates of the cells are
+ * copied in flat arrays at construction, so that queries never touch the (not thread safe) shared
+ * pointers of the mesh and can be run concurrently.
+ *
+ */
+
+namespace mito::search {
+
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    class BoundingVolumeHierarchy {
+
+      public:
+        // the mesh type
+        using mesh_type = meshT;
+        // the cell type
+        using cell_type = typename mesh_type::cell_type;
+        // the coordinate system type
+        using coord_system_type = coordSystemT;
+        // the coordinates type
+        using coordinates_type = typename coord_system_type::coordinates_type;
+        // the type of the parametric (barycentric) coordinates on a cell
+        using parametric_coordinates_type = typename cell_type::parametric_coordinates_type;
+
+        // the result of a point location: the index of the cell containing the point (-1 if the
+        // point was not found in the mesh) and the parametric coordinates of the point in the cell
+        struct location_type {
+            int cell;
+            parametric_coordinates_type xi;
+        };
+
+      private:
+        // the dimension of the physical space
+        static constexpr int D = coord_system_type::dim;
+        // the order of the cells
+        static constexpr int N = cell_type::order;
+        // the number of vertices per cell
+        static constexpr int V = cell_type::n_vertices;
+        // the maximum number of cells in a leaf of the hierarchy
+        static constexpr int leaf_size = 4;
+        // the type of a point in flat storage
+        using point_type = std::array<double, D>;
+
+        // a box of the hierarchy
+        struct box_type {
+            // the lower corner of the box
+            point_type lower;
+            // the upper corner of the box
+            point_type upper;
+            // the first child box for internal boxes, the offset in {_order} for leaves
+            int begin;
+            // -1 for internal boxes (the second child is {begin + 1}), the number of cells for
+            // leaves
+            int count;
+        };
+
+      public:
+        // constructor
+        BoundingVolumeHierarchy(const mesh_type & mesh, const coord_system_type & coord_system) :
+            _cells(),
+            _vertices(),
+            _order(),
+            _boxes(),
+            _tolerance(1.0e-12)
+        {
+            // reserve memory
+            _cells.reserve(mesh.nCells());
+            _vertices.reserve(V * mesh.nCells());
+
+            // copy the coordinates of the cell vertices in flat storage
+            for (const auto & cell : mesh.cells()) {
+                _cells.push_back(&cell);
+                for (const auto & node : cell.nodes()) {
+                    const auto & coord = coord_system.coordinates(node->point());
+                    point_type point;
+                    for (int d = 0; d < D; ++d) {
+                        point[d] = coord[d];
+                    }
+                    _vertices.push_back(point);
+                }
+            }
+
+            // nothing to build for an empty mesh
+            if (std::size(_cells) == 0) {
+                return;
+            }
+
+            // the centroids of the cells
+            std::vector<point_type> centroids(std::size(_cells));
+            utilities::parallel_for(0, std::size(_cells), [&](int begin, int end) {
+                for (int c = begin; c < end; ++c) {
+                    centroids[c].fill(0.0);
+                    for (int a = 0; a < V; ++a) {
+                        for (int d = 0; d < D; ++d) {
+                            centroids[c][d] += _vertices[V * c + a][d] / V;
+                        }
+                    }
+                }
+            });
+
+            // the permutation of the cells induced by the hierarchy
+            _order.resize(std::size(_cells));
+            std::iota(std::begin(_order), std::end(_order), 0);
+
+            // a binary tree with at most {leaf_size} cells per leaf has fewer than 2n boxes
+            _boxes.reserve(2 * std::size(_cells));
+
+            // build the hierarchy recursively starting from the root box
+            _boxes.emplace_back();
+            _build(0, 0, std::size(_cells), centroids);
+        }
+
+        // destructor
+        ~BoundingVolumeHierarchy() = default;
+
+        // move constructor
+        BoundingVolumeHierarchy(BoundingVolumeHierarchy &&) noexcept = default;
+
+      private:
+        // delete copy constructor
+        BoundingVolumeHierarchy(const BoundingVolumeHierarchy &) = delete;
+
+        // delete assignment operator
+        BoundingVolumeHierarchy & operator=(const BoundingVolumeHierarchy &) = delete;
+
+        // delete move assignment operator
+        BoundingVolumeHierarchy & operator=(BoundingVolumeHierarchy &&) noexcept = delete;
+
+      public:
+        // the number of cells in the hierarchy
+        auto size() const noexcept -> int { return std::size(_cells); }
+
+        // the cell with index {index}
+        auto cell(int index) const -> const cell_type & { return *_cells[index]; }
+
+        // set the (relative) tolerance used to decide if a point lies in a cell
+        auto tolerance(double tolerance) -> void { _tolerance = tolerance; }
+
+        // locate the cell containing the point at {coord}
+        auto locate(const coordinates_type & coord) const -> location_type
+        {
+            // copy the coordinates in flat storage
+            point_type x;
+            for (int d = 0; d < D; ++d) {
+                x[d] = coord[d];
+            }
+
+            // the barycentric coordinates of {x} in the cell found
+            std::array<double, N> xi;
+            xi.fill(0.0);
+
+            // search for the cell
+            int cell = _locate(x, xi);
+
+            // all done
+            return { cell, _parametric_coordinates(xi, tensor::make_integer_sequence<N>{}) };
+        }
+
+        // locate the cells containing each point in {coords} (the points are processed
+        // concurrently)
+        auto locate(const std::vector<coordinates_type> & coords) const
+            -> std::vector<location_type>
+        {
+            // the number of points
+            int n_points = std::size(coords);
+
+            // the flat copies of the points, of the cells found and of the barycentric coordinates
+            std::vector<point_type> x(n_points);
+            std::vector<int> cells(n_points);
+            std::vector<std::array<double, N>> xis(n_points);
+
+            // copy the coordinates in flat storage and run the queries
+            utilities::parallel_for(
+                0, n_points,
+                [&](int begin, int end) {
+                    for (int i = begin; i < end; ++i) {
+                        for (int d = 0; d < D; ++d) {
+                            x[i][d] = coords[i][d];
+                        }
+                        xis[i].fill(0.0);
+                        cells[i] = _locate(x[i], xis[i]);
+                    }
+                },
+                64);
+
+            // assemble the result
+            std::vector<location_type> locations;
+            locations.reserve(n_points);
+            for (int i = 0; i < n_points; ++i) {
+                auto xi = _parametric_coordinates(xis[i], tensor::make_integer_sequence<N>{});
+                locations.push_back({ cells[i], xi });
+            }
+
+            // all done
+            return locations;
+        }
+
+      private:
+        // build the box {box} enclosing the cells in positions [{begin}, {end}) of {_order}
+        auto _build(int box, int begin, int end, const std::vector<point_type> & centroids) -> void
+        {
+            // compute the box enclosing the vertices of the cells
+            point_type lower;
+            point_type upper;
+            lower.fill(std::numeric_limits<double>::max());
+            upper.fill(std::numeric_limits<double>::lowest());
+            for (int i = begin; i < end; ++i) {
+                for (int a = 0; a < V; ++a) {
+                    const auto & vertex = _vertices[V * _order[i] + a];
+                    for (int d = 0; d < D; ++d) {
+                        lower[d] = std::min(lower[d], vertex[d]);
+                        upper[d] = std::max(upper[d], vertex[d]);
+                    }
+                }
+            }
+            _boxes[box].lower = lower;
+            _boxes[box].upper = upper;
+
+            // if few enough cells are left, make this box a leaf
+            if (end - begin <= leaf_size) {
+                _boxes[box].begin = begin;
+                _boxes[box].count = end - begin;
+                // all done
+                return;
+            }
+
+            // split along the longest axis of the box
+            int axis = 0;
+            for (int d = 1; d < D; ++d) {
+                if (upper[d] - lower[d] > upper[axis] - lower[axis]) {
+                    axis = d;
+                }
+            }
+
+            // partition the cells at the median of their centroids along {axis}
+            int middle = begin + (end - begin) / 2;
+            auto closer = [&centroids, axis](int a, int b) {
+                return centroids[a][axis] < centroids[b][axis];
+            };
+            std::nth_element(
+                std::begin(_order) + begin, std::begin(_order) + middle, std::begin(_order) + end,
+                closer);
+
+            // create the two children (contiguously) and build them
+            int left = std::size(_boxes);
+            _boxes.emplace_back();
+            _boxes.emplace_back();
+            _boxes[box].begin = left;
+            _boxes[box].count = -1;
+            _build(left, begin, middle, centroids);
+            _build(left + 1, middle, end, centroids);
+
+            // all done
+            return;
+        }
+
+        // check whether {x} lies in box {box} (up to the tolerance)
+        auto _contains(const box_type & box, const point_type & x) const -> bool
+        {
+            for (int d = 0; d < D; ++d) {
+                // the tolerance on this axis
+                double tolerance = _tolerance * (1.0 + box.upper[d] - box.lower[d]);
+                if (x[d] < box.lower[d] - tolerance || x[d] > box.upper[d] + tolerance) {
+                    return false;
+                }
+            }
+
+            // all done
+            return true;
+        }
+
+        // compute the barycentric coordinates {xi} of {x} in cell {cell} and return whether {x}
+        // lies in the cell (up to the tolerance)
+        auto _barycentric(int cell, const point_type & x, std::array<double, N> & xi) const -> bool
+        {
+            // the last vertex of the cell (the parametrization reads
+            // x = x_N + sum_a xi_a (x_a - x_N))
+            const auto & x_N = _vertices[V * cell + N];
+
+            // the director vectors {x_a - x_N} and the vector {x - x_N}
+            std::array<point_type, N> J;
+            point_type r;
+            double size = 0.0;
+            for (int d = 0; d < D; ++d) {
+                for (int a = 0; a < N; ++a) {
+                    J[a][d] = _vertices[V * cell + a][d] - x_N[d];
+                    size = std::max(size, std::abs(J[a][d]));
+                }
+                r[d] = x[d] - x_N[d];
+            }
+
+            // assemble the normal equations {J^T J xi = J^T r} (the plain system if {N == D})
+            std::array<std::array<double, N + 1>, N> A;
+            for (int a = 0; a < N; ++a) {
+                for (int b = 0; b < N; ++b) {
+                    A[a][b] = 0.0;
+                    for (int d = 0; d < D; ++d) {
+                        A[a][b] += J[a][d] * J[b][d];
+                    }
+                }
+                A[a][N] = 0.0;
+                for (int d = 0; d < D; ++d) {
+                    A[a][N] += J[a][d] * r[d];
+                }
+            }
+
+            // solve by gaussian elimination with partial pivoting
+            for (int k = 0; k < N; ++k) {
+                int pivot = k;
+                for (int i = k + 1; i < N; ++i) {
+                    if (std::abs(A[i][k]) > std::abs(A[pivot][k])) {
+                        pivot = i;
+                    }
+                }
+                std::swap(A[k], A[pivot]);
+                // a degenerate cell contains no point
+                if (A[k][k] == 0.0) {
+                    return false;
+                }
+                for (int i = k + 1; i < N; ++i) {
+                    double factor = A[i][k] / A[k][k];
+                    for (int j = k; j <= N; ++j) {
+                        A[i][j] -= factor * A[k][j];
+                    }
+                }
+            }
+            for (int k = N - 1; k >= 0; --k) {
+                double value = A[k][N];
+                for (int j = k + 1; j < N; ++j) {
+                    value -= A[k][j] * xi[j];
+                }
+                xi[k] = value / A[k][k];
+            }
+
+            // the point lies in the cell if all barycentric coordinates are non-negative...
+            double xi_N = 1.0;
+            for (int a = 0; a < N; ++a) {
+                if (xi[a] < -_tolerance) {
+                    return false;
+                }
+                xi_N -= xi[a];
+            }
+            if (xi_N < -_tolerance) {
+                return false;
+            }
+
+            // ... and (for cells embedded in higher dimension) if it lies on the cell
+            if constexpr (N < D) {
+                for (int d = 0; d < D; ++d) {
+                    double residual = r[d];
+                    for (int a = 0; a < N; ++a) {
+                        residual -= xi[a] * J[a][d];
+                    }
+                    if (std::abs(residual) > _tolerance * (1.0 + size)) {
+                        return false;
+                    }
+                }
+            }
+
+            // all done
+            return true;
+        }
+
+        // search the hierarchy for the cell containing {x}; return its index or -1 if not found
+        auto _locate(const point_type & x, std::array<double, N> & xi) const -> int
+        {
+            // an empty hierarchy contains no point
+            if (std::size(_boxes) == 0) {
+                return -1;
+            }
+
+            // the stack of boxes to visit (the depth of the hierarchy is logarithmic)
+            std::array<int, 128> stack;
+            int top = 0;
+            stack[top++] = 0;
+
+            // visit the boxes containing {x}
+            while (top > 0) {
+                const auto & box = _boxes[stack[--top]];
+                if (!_contains(box, x)) {
+                    continue;
+                }
+                // if the box is a leaf, test its cells
+                if (box.count >= 0) {
+                    for (int i = box.begin; i < box.begin + box.count; ++i) {
+                        if (_barycentric(_order[i], x, xi)) {
+                            return _order[i];
+                        }
+                    }
+                }
+                // otherwise, visit its children
+                else {
+                    stack[top++] = box.begin;
+                    stack[top++] = box.begin + 1;
+                }
+            }
+
+            // the point does not lie in any cell
+            return -1;
+        }
+
+        // convert the flat barycentric coordinates in parametric coordinates
+        template <int... a>
+        static auto _parametric_coordinates(
+            const std::array<double, N> & xi, tensor::integer_sequence<a...>)
+            -> parametric_coordinates_type
+        {
+            return parametric_coordinates_type(xi[a]...);
+        }
+
+      private:
+        // the cells in the hierarchy
+        std::vector<const cell_type *> _cells;
+        // the coordinates of the vertices of the cells ({V} consecutive entries per cell)
+        std::vector<point_type> _vertices;
+        // the permutation of the cells such that each leaf holds a contiguous range
+        std::vector<int> _order;
+        // the boxes of the hierarchy (the root box is the first)
+        std::vector<box_type> _boxes;
+        // the relative tolerance for point location
+        double _tolerance;
+    };
+
+}    // namespace mito::search
+
+
+// end of file
@@ -0,0 +1,299 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+/*
+ * This class represents a k-d tree over a collection of points (or nodes) of a coordinate system,
+ * for nearest neighbor and radius queries.
+ *
+ * The tree is stored implicitly: the points are permuted so that the median point of each range
+ * splits the range along the axis recorded for it. The coordinates are copied in flat storage at
+ * construction, so that queries never touch the (not thread safe) shared pointers and can be run
+ * concurrently. Queries return the index of the points in the collection the tree was built from.
+ *
+ */
+
+namespace mito::search {
+
+    template <class keyT, geometry::coordinate_system_c coordSystemT>
+    class KdTree {
+
+      public:
+        // the type of the items in the tree (either points or nodes)
+        using key_type = keyT;
+        // the collection of items in the tree
+        using keys_type = std::vector<key_type>;
+        // the coordinate system type
+        using coord_system_type = coordSystemT;
+        // the coordinates type
+        using coordinates_type = typename coord_system_type::coordinates_type;
+
+      private:
+        // the dimension of the physical space
+        static constexpr int D = coord_system_type::dim;
+        // the type of a point in flat storage
+        using point_type = std::array<double, D>;
+
+      public:
+        // constructor
+        KdTree(keys_type && keys, const coord_system_type & coord_system) :
+            _keys(std::move(keys)),
+            _points(std::size(_keys)),
+            _order(std::size(_keys)),
+            _axes(std::size(_keys), 0)
+        {
+            // copy the coordinates in flat storage
+            for (int i = 0; i < std::ssize(_keys); ++i) {
+                const auto & coord = coord_system.coordinates(_point(_keys[i]));
+                for (int d = 0; d < D; ++d) {
+                    _points[i][d] = coord[d];
+                }
+            }
+
+            // build the tree over the whole collection
+            std::iota(std::begin(_order), std::end(_order), 0);
+            _build(0, std::size(_order));
+        }
+
+        // destructor
+        ~KdTree() = default;
+
+        // move constructor
+        KdTree(KdTree &&) noexcept = default;
+
+      private:
+        // delete copy constructor
+        KdTree(const KdTree &) = delete;
+
+        // delete assignment operator
+        KdTree & operator=(const KdTree &) = delete;
+
+        // delete move assignment operator
+        KdTree & operator=(KdTree &&) noexcept = delete;
+
+      public:
+        // the number of items in the tree
+        auto size() const noexcept -> int { return std::size(_keys); }
+
+        // the item with index {index}
+        auto key(int index) const -> const key_type & { return _keys[index]; }
+
+        // the index of the item nearest to {coord} (-1 if the tree is empty)
+        auto nearest(const coordinates_type & coord) const -> int
+        {
+            // the closest item so far and its squared distance
+            int best = -1;
+            double best_distance = std::numeric_limits<double>::max();
+
+            // search the tree
+            _nearest(_flat(coord), 0, std::size(_order), best, best_distance);
+
+            // all done
+            return best;
+        }
+
+        // the indices of the items nearest to each point in {coords} (the points are processed
+        // concurrently)
+        auto nearest(const std::vector<coordinates_type> & coords) const -> std::vector<int>
+        {
+            // the result
+            std::vector<int> result(std::size(coords), -1);
+
+            // run the queries
+            utilities::parallel_for(
+                0, std::size(coords),
+                [&](int begin, int end) {
+                    for (int i = begin; i < end; ++i) {
+                        double best_distance = std::numeric_limits<double>::max();
+                        _nearest(_flat(coords[i]), 0, std::size(_order), result[i], best_distance);
+                    }
+                },
+                64);
+
+            // all done
+            return result;
+        }
+
+        // the indices of the items within distance {radius} from {coord}
+        auto within(const coordinates_type & coord, double radius) const -> std::vector<int>
+        {
+            // the result
+            std::vector<int> result;
+
+            // search the tree
+            _within(_flat(coord), radius * radius, 0, std::size(_order), result);
+
+            // all done
+            return result;
+        }
+
+      private:
+        // the point of {key}
+        static auto _point(const key_type & key) -> const auto &
+        {
+            // if the items are points, the key is the point
+            if constexpr (std::is_same_v<key_type, typename coord_system_type::point_type>) {
+                return key;
+            }
+            // otherwise the items are nodes
+            else {
+                return key->point();
+            }
+        }
+
+        // copy {coord} in flat storage
+        static auto _flat(const coordinates_type & coord) -> point_type
+        {
+            point_type x;
+            for (int d = 0; d < D; ++d) {
+                x[d] = coord[d];
+            }
+            return x;
+        }
+
+        // the squared distance between {x} and the item in position {i} of {_order}
+        auto _distance(const point_type & x, int i) const -> double
+        {
+            double distance = 0.0;
+            for (int d = 0; d < D; ++d) {
+                double delta = x[d] - _points[_order[i]][d];
+                distance += delta * delta;
+            }
+            return distance;
+        }
+
+        // build the subtree over positions [{begin}, {end}) of {_order}
+        auto _build(int begin, int end) -> void
+        {
+            // nothing to split in an empty range
+            if (end - begin <= 0) {
+                return;
+            }
+
+            // split along the axis of largest spread
+            point_type lower;
+            point_type upper;
+            lower.fill(std::numeric_limits<double>::max());
+            upper.fill(std::numeric_limits<double>::lowest());
+            for (int i = begin; i < end; ++i) {
+                for (int d = 0; d < D; ++d) {
+                    lower[d] = std::min(lower[d], _points[_order[i]][d]);
+                    upper[d] = std::max(upper[d], _points[_order[i]][d]);
+                }
+            }
+            int axis = 0;
+            for (int d = 1; d < D; ++d) {
+                if (upper[d] - lower[d] > upper[axis] - lower[axis]) {
+                    axis = d;
+                }
+            }
+
+            // place the median item in the middle of the range
+            int middle = begin + (end - begin) / 2;
+            auto closer = [this, axis](int a, int b) {
+                return _points[a][axis] < _points[b][axis];
+            };
+            std::nth_element(
+                std::begin(_order) + begin, std::begin(_order) + middle, std::begin(_order) + end,
+                closer);
+            _axes[middle] = axis;
+
+            // build the two halves
+            _build(begin, middle);
+            _build(middle + 1, end);
+
+            // all done
+            return;
+        }
+
+        // search the subtree over positions [{begin}, {end}) for the item nearest to {x}
+        auto _nearest(const point_type & x, int begin, int end, int & best, double & best_distance)
+            const -> void
+        {
+            // nothing to search in an empty range
+            if (end - begin <= 0) {
+                return;
+            }
+
+            // check the median item
+            int middle = begin + (end - begin) / 2;
+            double distance = _distance(x, middle);
+            if (distance < best_distance) {
+                best = _order[middle];
+                best_distance = distance;
+            }
+
+            // the signed distance from the splitting plane
+            int axis = _axes[middle];
+            double delta = x[axis] - _points[_order[middle]][axis];
+
+            // search the near half first, then the far half if it can contain a closer item
+            if (delta < 0.0) {
+                _nearest(x, begin, middle, best, best_distance);
+                if (delta * delta < best_distance) {
+                    _nearest(x, middle + 1, end, best, best_distance);
+                }
+            } else {
+                _nearest(x, middle + 1, end, best, best_distance);
+                if (delta * delta < best_distance) {
+                    _nearest(x, begin, middle, best, best_distance);
+                }
+            }
+
+            // all done
+            return;
+        }
+
+        // collect the items of the subtree over positions [{begin}, {end}) within squared
+        // distance {radius2} from {x}
+        auto _within(
+            const point_type & x, double radius2, int begin, int end, std::vector<int> & result)
+            const -> void
+        {
+            // nothing to search in an empty range
+            if (end - begin <= 0) {
+                return;
+            }
+
+            // check the median item
+            int middle = begin + (end - begin) / 2;
+            if (_distance(x, middle) <= radius2) {
+                result.push_back(_order[middle]);
+            }
+
+            // the signed distance from the splitting plane
+            int axis = _axes[middle];
+            double delta = x[axis] - _points[_order[middle]][axis];
+
+            // visit the halves intersecting the ball
+            if (delta <= 0.0 || delta * delta <= radius2) {
+                _within(x, radius2, begin, middle, result);
+            }
+            if (delta >= 0.0 || delta * delta <= radius2) {
+                _within(x, radius2, middle + 1, end, result);
+            }
+
+            // all done
+            return;
+        }
+
+      private:
+        // the items in the tree
+        keys_type _keys;
+        // the coordinates of the items (in the order of {_keys})
+        std::vector<point_type> _points;
+        // the permutation of the items defining the tree
+        std::vector<int> _order;
+        // the splitting axis of the median of each range (indexed by position in {_order})
+        std::vector<int> _axes;
+    };
+
+}    // namespace mito::search
+
+
+// end of file
@@ -0,0 +1,39 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::search {
+
+    // bounding volume hierarchy alias
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    using bvh_t = BoundingVolumeHierarchy<meshT, coordSystemT>;
+
+    // k-d tree alias
+    template <class keyT, geometry::coordinate_system_c coordSystemT>
+    using kd_tree_t = KdTree<keyT, coordSystemT>;
+
+    // bounding volume hierarchy factory over the cells of {mesh}
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    auto bvh(const meshT & mesh, const coordSystemT & coord_system) -> bvh_t<meshT, coordSystemT>;
+
+    // k-d tree factory over the points placed in {coord_system}
+    template <geometry::coordinate_system_c coordSystemT>
+    auto kd_tree(const coordSystemT & coord_system)
+        -> kd_tree_t<typename coordSystemT::point_type, coordSystemT>;
+
+    // k-d tree factory over the nodes of {mesh}
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    auto kd_tree(const meshT & mesh, const coordSystemT & coord_system)
+        -> kd_tree_t<typename meshT::node_type, coordSystemT>;
+}
+
+
+// end of file
@@ -0,0 +1,26 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+// externals
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <unordered_set>
+#include <vector>
+
+// support
+#include "../journal.h"
+#include "../utilities.h"
+#include "../geometry.h"
+#include "../mesh.h"
+
+
+// end of file
@@ -0,0 +1,64 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::search {
+
+    // bounding volume hierarchy factory over the cells of {mesh}
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    auto bvh(const meshT & mesh, const coordSystemT & coord_system) -> bvh_t<meshT, coordSystemT>
+    {
+        return bvh_t<meshT, coordSystemT>(mesh, coord_system);
+    }
+
+    // k-d tree factory over the points placed in {coord_system}
+    template <geometry::coordinate_system_c coordSystemT>
+    auto kd_tree(const coordSystemT & coord_system)
+        -> kd_tree_t<typename coordSystemT::point_type, coordSystemT>
+    {
+        // the type of point
+        using point_type = typename coordSystemT::point_type;
+
+        // collect the points placed in the coordinate system
+        std::vector<point_type> points;
+        for (const auto & [point, _] : coord_system) {
+            points.push_back(point);
+        }
+
+        // all done
+        return kd_tree_t<point_type, coordSystemT>(std::move(points), coord_system);
+    }
+
+    // k-d tree factory over the nodes of {mesh}
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    auto kd_tree(const meshT & mesh, const coordSystemT & coord_system)
+        -> kd_tree_t<typename meshT::node_type, coordSystemT>
+    {
+        // the type of node
+        using node_type = typename meshT::node_type;
+
+        // collect the nodes of the mesh (eliminating duplicates)
+        std::unordered_set<node_type, utilities::hash_function<node_type>> nodes_set;
+        std::vector<node_type> nodes;
+        for (const auto & cell : mesh.cells()) {
+            for (const auto & node : cell.nodes()) {
+                if (nodes_set.insert(node).second) {
+                    nodes.push_back(node);
+                }
+            }
+        }
+
+        // all done
+        return kd_tree_t<node_type, coordSystemT>(std::move(nodes), coord_system);
+    }
+}
+
+
+// end of file
@@ -0,0 +1,23 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::search {
+
+    // class bounding volume hierarchy over the cells of a mesh
+    template <mesh::mesh_c meshT, geometry::coordinate_system_c coordSystemT>
+    requires(utilities::same_dim_c<meshT, coordSystemT>)
+    class BoundingVolumeHierarchy;
+
+    // class k-d tree over a collection of points (or nodes)
+    template <class keyT, geometry::coordinate_system_c coordSystemT>
+    class KdTree;
+}
+
+
+// end of file
@@ -0,0 +1,27 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+// external packages
+#include "externals.h"
+
+// get the forward declarations
+#include "forward.h"
+
+// published type factories; this is the file you are looking for...
+#include "api.h"
+
+// classes implementation
+#include "BoundingVolumeHierarchy.h"
+#include "KdTree.h"
+
+// factories implementation
+#include "factories.h"
+
+
+// end of file
@@ -46,6 +46,9 @@ namespace mito::simulation {
         // accessor for the simulation clock time
         auto clock() const -> const clock_type &;
 
+        // advance the simulation clock by {dt}
+        auto advance(clock_type dt) -> const clock_type &;
+
       private:
         // the simulation execution context
         execution_context_type _execution_context;
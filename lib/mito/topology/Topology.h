@@ -72,7 +72,22 @@ namespace mito::topology {
         // instantiate a tetrahedron
         inline auto tetrahedron(const vertex_simplex_composition_t<3> & vertices) -> simplex_t<3>;
 
+        // return the simplices with vertices {vertices}, one per entry, instantiated in bulk: the
+        // tuples of vertices of the simplices (and, recursively, of their subsimplices) are sorted
+        // so that each distinct simplex is looked up (or created) in the factories only once
+        template <int N>
+        inline auto simplices(std::span<const vertex_simplex_composition_t<N>> vertices)
+            -> std::vector<simplex_t<N>>
+        requires(N >= 1 && N <= 3);
+
       private:
+        // the vertices of the subsimplices of the simplex with vertices {vertices}, in the order
+        // of its composition
+        template <int N>
+        static inline auto _subsimplices(const vertex_simplex_composition_t<N> & vertices)
+            -> std::array<vertex_simplex_composition_t<N - 1>, N + 1>
+        requires(N == 2 || N == 3);
+
         template <int N>
         inline auto _erase(simplex_t<N> & simplex) -> void
         requires(N == 0);
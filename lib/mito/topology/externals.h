@@ -11,7 +11,10 @@
 #include <algorithm>
 #include <array>
 #include <map>
+#include <span>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 // support
 #include "../journal.h"
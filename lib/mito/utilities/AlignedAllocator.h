@@ -0,0 +1,60 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::utilities {
+
+    // an allocator of storage aligned to {alignment} bytes (a cache line, by default), e.g. for
+    // arrays streamed by vectorized loops
+    template <class T, std::size_t alignment>
+    class AlignedAllocator {
+
+      public:
+        // the type of the allocated values
+        using value_type = T;
+
+        // the same allocator for values of type {U}
+        template <class U>
+        struct rebind {
+            using other = AlignedAllocator<U, alignment>;
+        };
+
+      public:
+        // default constructor
+        constexpr AlignedAllocator() noexcept = default;
+
+        // converting constructor from the allocator of another type
+        template <class U>
+        constexpr AlignedAllocator(const AlignedAllocator<U, alignment> &) noexcept
+        {}
+
+      public:
+        // allocate storage for {n} values
+        [[nodiscard]] inline auto allocate(std::size_t n) -> value_type *
+        {
+            return static_cast<value_type *>(
+                ::operator new(n * sizeof(value_type), std::align_val_t(alignment)));
+        }
+
+        // release the storage of {n} values at {pointer}
+        inline auto deallocate(value_type * pointer, std::size_t) noexcept -> void
+        {
+            ::operator delete(pointer, std::align_val_t(alignment));
+        }
+
+        // all aligned allocators are interchangeable
+        template <class U>
+        constexpr auto operator==(const AlignedAllocator<U, alignment> &) const noexcept -> bool
+        {
+            return true;
+        }
+    };
+}
+
+
+// end of file
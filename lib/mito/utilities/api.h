@@ -33,6 +33,10 @@ namespace mito::utilities {
     template <class resourceT>
     using segmented_vector_t = SegmentedVector<resourceT>;
 
+    // vector with storage aligned to a cache line alias
+    template <class T>
+    using aligned_vector_t = std::vector<T, AlignedAllocator<T>>;
+
     // concept of the types having the same dimension
     template <class F1, class F2>
     concept same_dim_c = F1::dim == F2::dim;
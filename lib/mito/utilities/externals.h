@@ -14,10 +14,17 @@
 #include <utility>
 #include <memory>
 #include <type_traits>
+#include <cstddef>
 #include <cstdint>
+#include <new>
 #include <string>
 #include <typeinfo>
 #include <cxxabi.h>
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <thread>
 
 // support
 #include "../journal.h"
@@ -53,6 +53,13 @@ namespace mito::utilities {
     template <class resourceT>
     requires invalidatable_c<resourceT>
     class SegmentedVector;
+
+    // the size in bytes of a cache line
+    inline constexpr std::size_t cache_line_size = 64;
+
+    // class aligned allocator
+    template <class T, std::size_t alignment = cache_line_size>
+    class AlignedAllocator;
 }
 
 
@@ -0,0 +1,146 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// code guard
+#pragma once
+
+
+namespace mito::utilities {
+
+    // the number of threads used by the parallel algorithms
+    inline auto n_threads() -> int
+    {
+        // honor the {MITO_NUM_THREADS} environment variable, if set
+        if (const char * env = std::getenv("MITO_NUM_THREADS"); env != nullptr) {
+            return std::max(1, std::atoi(env));
+        }
+
+        // otherwise, use as many threads as the hardware supports
+        return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    // split the range [{begin}, {end}) in contiguous chunks of at least {grain} items and call
+    // {body(chunk_begin, chunk_end)} on each chunk concurrently
+    // Note that {body} must only touch data that is not shared among chunks (in particular, it
+    // should not copy shared pointers, whose reference count is not thread safe)
+    template <class bodyT>
+    inline auto parallel_for(int begin, int end, bodyT && body, int grain = 1024) -> void
+    {
+        // the number of items in the range
+        int n_items = end - begin;
+
+        // nothing to do for an empty range
+        if (n_items <= 0) {
+            return;
+        }
+
+        // the number of chunks (at most one per thread, at least {grain} items each)
+        int n_chunks = std::min(n_threads(), std::max(1, n_items / std::max(1, grain)));
+
+        // if a single chunk is needed, do the work on the calling thread
+        if (n_chunks == 1) {
+            body(begin, end);
+            return;
+        }
+
+        // the exceptions thrown by each chunk, if any
+        std::vector<std::exception_ptr> errors(n_chunks);
+
+        // the worker threads (the calling thread works on the first chunk)
+        std::vector<std::thread> workers;
+        workers.reserve(n_chunks - 1);
+
+        // the work assigned to chunk {chunk}
+        auto work = [&](int chunk) {
+            // the range of items of this chunk
+            int chunk_begin = begin + static_cast<int>((1L * n_items * chunk) / n_chunks);
+            int chunk_end = begin + static_cast<int>((1L * n_items * (chunk + 1)) / n_chunks);
+            try {
+                body(chunk_begin, chunk_end);
+            } catch (...) {
+                errors[chunk] = std::current_exception();
+            }
+        };
+
+        // launch the workers
+        for (int chunk = 1; chunk < n_chunks; ++chunk) {
+            workers.emplace_back(work, chunk);
+        }
+
+        // work on the first chunk
+        work(0);
+
+        // wait for the workers
+        for (auto & worker : workers) {
+            worker.join();
+        }
+
+        // rethrow the first exception, if any
+        for (const auto & error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        // all done
+        return;
+    }
+
+    // sort {items} according to {compare}, sorting contiguous chunks concurrently and merging
+    // them pairwise
+    template <class itemT, class compareT = std::less<itemT>>
+    inline auto parallel_sort(std::vector<itemT> & items, compareT compare = compareT()) -> void
+    {
+        // the number of items
+        int n_items = std::size(items);
+
+        // the number of chunks (at most one per thread, at least {grain} items each)
+        constexpr int grain = 1 << 14;
+        int n_chunks = std::min(n_threads(), std::max(1, n_items / grain));
+
+        // the boundaries of the chunks
+        std::vector<int> bounds(n_chunks + 1);
+        for (int chunk = 0; chunk <= n_chunks; ++chunk) {
+            bounds[chunk] = static_cast<int>((1L * n_items * chunk) / n_chunks);
+        }
+
+        // sort each chunk
+        parallel_for(
+            0, n_chunks,
+            [&](int begin, int end) {
+                for (int chunk = begin; chunk < end; ++chunk) {
+                    std::sort(
+                        std::begin(items) + bounds[chunk], std::begin(items) + bounds[chunk + 1],
+                        compare);
+                }
+            },
+            1);
+
+        // merge pairs of neighboring sorted ranges until a single range is left
+        for (int width = 1; width < n_chunks; width *= 2) {
+            // the number of merges at this level
+            int n_merges = (n_chunks + 2 * width - 1) / (2 * width);
+            parallel_for(
+                0, n_merges,
+                [&](int begin, int end) {
+                    for (int merge = begin; merge < end; ++merge) {
+                        int first = 2 * width * merge;
+                        int middle = std::min(first + width, n_chunks);
+                        int last = std::min(first + 2 * width, n_chunks);
+                        std::inplace_merge(
+                            std::begin(items) + bounds[first], std::begin(items) + bounds[middle],
+                            std::begin(items) + bounds[last], compare);
+                    }
+                },
+                1);
+        }
+
+        // all done
+        return;
+    }
+}
+
+
+// end of file
@@ -25,6 +25,7 @@
 #include "SegmentedAllocator.h"
 #include "SegmentedAllocatorIterator.h"
 #include "SegmentedVector.h"
+#include "AlignedAllocator.h"
 #include "Repository.h"
 #include "SegmentedContainerIterator.h"
 #include "NamedClass.h"
@@ -34,6 +35,7 @@
 
 // utilities
 #include "utilities.h"
+#include "parallel.h"
 
 
 // end of file
@@ -0,0 +1,130 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/discrete.h>
+#include <mito/mesh.h>
+#include <mito/io.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+// the type of cell
+using cell_t = mito::geometry::triangle_t<2>;
+
+// the x scalar field in 2D
+constexpr auto x = mito::functions::component<coordinates_t, 0>;
+
+
+TEST(Discretization, DenseMeshField)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // read the mesh of a rectangle
+    std::ifstream fileStream("rectangle.summit");
+    auto mesh = mito::io::summit::reader<cell_t>(fileStream, coord_system);
+
+    // a dense mesh field with the x coordinate of the nodes
+    auto x_field = mito::discrete::dense_mesh_field(mesh, coord_system, x, "x");
+
+    // the nodes are numbered like the nodes of the mesh
+    auto numbering = mito::mesh::node_numbering(mesh);
+    ASSERT_EQ(x_field.size(), numbering.size());
+    ASSERT_EQ(std::ssize(x_field.values()), numbering.size());
+
+    // check the values by number and by node
+    for (int n = 0; n < numbering.size(); ++n) {
+        const auto & node = numbering.node(n);
+        EXPECT_TRUE(x_field.index().key(n) == node);
+        EXPECT_EQ(x_field.index()(node), n);
+        EXPECT_DOUBLE_EQ(x_field[n], coord_system.coordinates(node->point())[0]);
+        EXPECT_DOUBLE_EQ(x_field(node), x_field[n]);
+    }
+
+    // the same field stored by node
+    auto x_mesh_field = mito::discrete::mesh_field(mesh, coord_system, x, "x");
+    ASSERT_EQ(x_mesh_field.size(), x_field.size());
+    for (const auto & [node, value] : x_mesh_field) {
+        EXPECT_DOUBLE_EQ(value, x_field(node));
+    }
+
+    // a vector field on the same nodes, sharing the index
+    auto xy_field =
+        mito::discrete::dense_field<mito::tensor::vector_t<2>>(x_field.shared_index(), "xy");
+    EXPECT_EQ(&xy_field.index(), &x_field.index());
+
+    // fill the vector field by iterating on its entries
+    int n_entries = 0;
+    for (auto && [node, value] : xy_field) {
+        const auto & coords = coord_system.coordinates(node->point());
+        value = coords[0] * mito::tensor::e_0<2> + coords[1] * mito::tensor::e_1<2>;
+        ++n_entries;
+    }
+    EXPECT_EQ(n_entries, xy_field.size());
+
+    // check that the values are stored contiguously in the order of the index
+    for (int n = 0; n < xy_field.size(); ++n) {
+        EXPECT_DOUBLE_EQ(xy_field.values()[n][0], x_field.values()[n]);
+    }
+
+    // a node not in the mesh is not in the index
+    auto node = mito::geometry::node(coord_system, coordinates_t{ 100.0, 100.0 });
+    EXPECT_FALSE(x_field.index().contains(node));
+    EXPECT_EQ(x_field.index().find(node), -1);
+
+    // the vector field is seen by the writers as contiguous doubles
+    auto flat = mito::io::flat_values(xy_field.values());
+    ASSERT_EQ(std::ssize(flat), 2 * xy_field.size());
+    for (int n = 0; n < xy_field.size(); ++n) {
+        EXPECT_EQ(flat[2 * n], xy_field.values()[n][0]);
+        EXPECT_EQ(flat[2 * n + 1], xy_field.values()[n][1]);
+    }
+
+    // write the fields (both in place, with their shared index checked once against the grid)
+    auto writer = mito::io::vtu::field_writer("rectangle_dense_field", mesh, coord_system);
+    writer.record(x_field);
+    writer.record(xy_field);
+    writer.write();
+}
+
+
+TEST(Discretization, DenseQuadratureField)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // read the mesh of a rectangle
+    std::ifstream fileStream("rectangle.summit");
+    auto mesh = mito::io::summit::reader<cell_t>(fileStream, coord_system);
+
+    // a quadrature field with 3 scalar values per cell
+    auto field = mito::discrete::dense_quadrature_field<mito::tensor::scalar_t, 3>(mesh, "state");
+    ASSERT_EQ(field.size(), mesh.nCells());
+    ASSERT_EQ(std::ssize(field.values()), 3 * mesh.nCells());
+
+    // the values are aligned to a cache line
+    auto address = reinterpret_cast<std::uintptr_t>(field.values().data());
+    EXPECT_EQ(address % mito::utilities::cache_line_size, 0);
+
+    // the cells are numbered in the order of iteration on the cells, and the values are laid out
+    // as [cell][quadrature point]
+    int e = 0;
+    for (const auto & cell : mesh.cells()) {
+        EXPECT_EQ(field.index()(cell.simplex()), e);
+        for (int q = 0; q < 3; ++q) {
+            field(cell.simplex())[q] = 3 * e + q;
+        }
+        ++e;
+    }
+    for (int i = 0; i < std::ssize(field.values()); ++i) {
+        EXPECT_EQ(field.values()[i], i);
+        EXPECT_EQ(&field(i / 3, i % 3), &field.values()[i]);
+    }
+}
+
+
+// end of file
@@ -0,0 +1,105 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/discrete.h>
+#include <mito/mesh.h>
+#include <mito/io.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+// the type of cell
+using cell_t = mito::geometry::triangle_t<2>;
+
+// the x scalar field in 2D
+constexpr auto x = mito::functions::component<coordinates_t, 0>;
+// the y scalar field in 2D
+constexpr auto y = mito::functions::component<coordinates_t, 1>;
+
+
+TEST(Discretization, FieldAlgebra)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // read the mesh of a rectangle
+    std::ifstream fileStream("rectangle.summit");
+    auto mesh = mito::io::summit::reader<cell_t>(fileStream, coord_system);
+
+    // dense mesh fields with the x and y coordinates of the nodes
+    auto u = mito::discrete::dense_mesh_field(mesh, coord_system, x, "u");
+    auto v = mito::discrete::dense_mesh_field(mesh, coord_system, y, "v");
+
+    // a copy of the original values of {u}
+    std::vector<mito::tensor::scalar_t> u0(std::begin(u.values()), std::end(u.values()));
+
+    // update {u} in place with a linear combination of {u} and {v}
+    mito::discrete::assign(u, 2.0 * u + v * 3.0 - v / 2.0);
+    for (int n = 0; n < u.size(); ++n) {
+        EXPECT_DOUBLE_EQ(u[n], 2.0 * u0[n] + 2.5 * v[n]);
+    }
+
+    // the reductions, computed serially
+    mito::tensor::scalar_t uv = 0.0;
+    mito::tensor::scalar_t u_max = 0.0;
+    for (int n = 0; n < u.size(); ++n) {
+        uv += u[n] * v[n];
+        u_max = std::max(u_max, std::abs(u[n]));
+    }
+
+    // check the reductions
+    EXPECT_NEAR(mito::discrete::dot(u, v), uv, 1.e-12 * std::abs(uv));
+    EXPECT_DOUBLE_EQ(mito::discrete::norm_max(-u), u_max);
+    EXPECT_DOUBLE_EQ(mito::discrete::norm_l2(u), std::sqrt(mito::discrete::dot(u, u)));
+    EXPECT_NEAR(
+        mito::discrete::sum(u - v), mito::discrete::sum(u) - mito::discrete::sum(v), 1.e-10);
+
+    // a mesh with enough nodes for the reductions to span many blocks
+    auto big_mesh =
+        mito::mesh::generators::rectangle(coord_system, 150, 150, { 0.0, 0.0 }, { 1.0, 1.0 });
+    auto w = mito::discrete::dense_mesh_field(big_mesh, coord_system, x * x - y, "w");
+    auto z = mito::discrete::dense_mesh_field(big_mesh, coord_system, x + y * y, "z");
+
+    // save the number of threads of the environment
+    const char * env = std::getenv("MITO_NUM_THREADS");
+    std::string num_threads = (env != nullptr) ? env : "";
+
+    // the reductions are bitwise the same for any number of threads
+    setenv("MITO_NUM_THREADS", "1", 1);
+    auto dot_1 = mito::discrete::dot(w, z);
+    auto sum_1 = mito::discrete::sum(w + z);
+    auto l2_1 = mito::discrete::norm_l2(w);
+    setenv("MITO_NUM_THREADS", "3", 1);
+    auto dot_3 = mito::discrete::dot(w, z);
+    auto sum_3 = mito::discrete::sum(w + z);
+    auto l2_3 = mito::discrete::norm_l2(w);
+
+    // restore the number of threads of the environment
+    if (env != nullptr) {
+        setenv("MITO_NUM_THREADS", num_threads.c_str(), 1);
+    } else {
+        unsetenv("MITO_NUM_THREADS");
+    }
+
+    EXPECT_EQ(dot_1, dot_3);
+    EXPECT_EQ(sum_1, sum_3);
+    EXPECT_EQ(l2_1, l2_3);
+
+    // operands of different sizes cannot be combined
+    auto q = mito::discrete::dense_quadrature_field<mito::tensor::scalar_t, 3>(mesh, "q");
+    EXPECT_THROW(mito::discrete::assign(u, u + q), std::runtime_error);
+
+    // quadrature fields take part in the algebra as well
+    for (auto & value : q.values()) {
+        value = 1.0;
+    }
+    mito::discrete::assign(q, 4.0 * q);
+    EXPECT_DOUBLE_EQ(mito::discrete::sum(q), 12.0 * mesh.nCells());
+}
+
+
+// end of file
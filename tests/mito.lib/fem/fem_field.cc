@@ -81,4 +81,96 @@ TEST(Fem, FemField)
 
     // all done
     return;
-}
\ No newline at end of file
+}
+
+TEST(Fem, DenseFemField)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // read the mesh of a square in 2D
+    std::ifstream fileStream("square.summit");
+    auto mesh = mito::io::summit::reader<cell_t>(fileStream, coord_system);
+
+    // create the body manifold
+    auto manifold = mito::manifolds::manifold(mesh, coord_system);
+
+    // set homogeneous Dirichlet boundary condition
+    auto boundary_mesh = mito::mesh::boundary(mesh);
+    auto zero = mito::functions::zero<coordinates_t>;
+    auto constraints = mito::constraints::dirichlet_bc(boundary_mesh, zero);
+
+    // the function space (linear elements on the manifold)
+    auto function_space = mito::fem::function_space<finite_element_t>(manifold, constraints);
+
+    // get a scalar-valued fem field on the function space, with contiguous nodal values
+    auto fem_field = function_space.dense_fem_field<mito::tensor::scalar_t>("linear field");
+
+    // the nodal values are numbered like the discretization nodes
+    auto nodes = mito::fem::number_discretization_nodes(function_space).first;
+    ASSERT_EQ(fem_field.nodal_values().size(), std::ssize(nodes));
+
+    // create a continuous linear field
+    auto field = x + y;
+
+    // interpolate the continuous field on the fem field
+    mito::fem::interpolate(function_space, coord_system, field, fem_field);
+
+    // check that the localized field matches the continuous field at the element centers
+    for (const auto & element : function_space.elements()) {
+        auto local = fem_field.localize(element);
+        auto center_coords = mito::geometry::barycenter(element.cell(), coord_system);
+        EXPECT_DOUBLE_EQ(local({ 1.0 / 3.0, 1.0 / 3.0 }), field(center_coords));
+    }
+}
+
+
+TEST(Fem, DenseFemFieldP2)
+{
+    // second degree finite elements
+    using finite_element_p2_t = mito::fem::isoparametric_simplex_t<2, cell_t>;
+    // the parametric coordinates on the reference triangle
+    using parametric_coordinates_t =
+        mito::geometry::reference_triangle_t::parametric_coordinates_type;
+
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // read the mesh of a square in 2D
+    std::ifstream fileStream("square.summit");
+    auto mesh = mito::io::summit::reader<cell_t>(fileStream, coord_system);
+
+    // create the body manifold
+    auto manifold = mito::manifolds::manifold(mesh, coord_system);
+
+    // set homogeneous Dirichlet boundary condition
+    auto boundary_mesh = mito::mesh::boundary(mesh);
+    auto zero = mito::functions::zero<coordinates_t>;
+    auto constraints = mito::constraints::dirichlet_bc(boundary_mesh, zero);
+
+    // the function space (quadratic elements on the manifold)
+    auto function_space = mito::fem::function_space<finite_element_p2_t>(manifold, constraints);
+
+    // get a scalar-valued fem field on the function space, with contiguous nodal values
+    auto fem_field = function_space.dense_fem_field<mito::tensor::scalar_t>("quadratic field");
+
+    // create a continuous quadratic field
+    auto field = x * y + x * x;
+
+    // interpolate the continuous field on the fem field (also at the edge nodes)
+    mito::fem::interpolate(function_space, coord_system, field, fem_field);
+
+    // the element center and the midpoints of two edges in parametric coordinates
+    auto points = std::array{ parametric_coordinates_t({ 1.0 / 3.0, 1.0 / 3.0 }),
+                              parametric_coordinates_t({ 0.5, 0.5 }),
+                              parametric_coordinates_t({ 0.0, 0.5 }) };
+
+    // check that the localized field reproduces the quadratic field at these points
+    for (const auto & element : function_space.elements()) {
+        auto local = fem_field.localize(element);
+        auto parametrization = element.parametrization();
+        for (const auto & xi : points) {
+            EXPECT_NEAR(local(xi), field(coord_system.origin() + parametrization(xi)), 1.e-13);
+        }
+    }
+}
@@ -0,0 +1,95 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+// support
+#include <numbers>
+#include <vector>
+
+// dependencies
+#include <gtest/gtest.h>
+#include <mito/functions.h>
+
+
+// pi
+using std::numbers::pi;
+
+// vectors in 2D
+using vector_t = mito::tensor::vector_t<2>;
+
+
+// a batch of {n} points in 2D
+auto
+points(int n)
+{
+    std::vector<vector_t> x;
+    x.reserve(n);
+    for (int i = 0; i < n; ++i) {
+        x.push_back({ 0.01 * i, pi - 0.02 * i });
+    }
+
+    // all done
+    return x;
+}
+
+
+TEST(BatchedEvaluation, ScalarValuedFunctions)
+{
+    // the function extracting the x_0 component
+    constexpr auto x0 = mito::functions::component<vector_t, 0>;
+
+    // the function extracting the x_1 component
+    constexpr auto x1 = mito::functions::component<vector_t, 1>;
+
+    // a scalar-valued function combining sums, products, compositions and library functions
+    constexpr auto f = mito::functions::cos(x0 * x1) + 2.0 * x0 - x1 / (x0 + 1.0)
+                     + mito::functions::pow<2>(x0 - pi) * 0.5;
+
+    // a batch of points
+    auto x = points(1000);
+
+    // evaluate {f} on the batch
+    auto y = mito::functions::evaluate(f, std::span<const vector_t>(x));
+
+    // check that the batched evaluation matches the evaluation point by point
+    ASSERT_EQ(std::size(y), std::size(x));
+    for (int i = 0; i < std::ssize(x); ++i) {
+        EXPECT_DOUBLE_EQ(y[i], f(x[i]));
+    }
+}
+
+
+TEST(BatchedEvaluation, TensorValuedFunctions)
+{
+    // the function extracting the x_0 component
+    constexpr auto x0 = mito::functions::component<vector_t, 0>;
+
+    // the function extracting the x_1 component
+    constexpr auto x1 = mito::functions::component<vector_t, 1>;
+
+    // a vector-valued function
+    constexpr auto v = x0 * mito::functions::constant<vector_t>(mito::tensor::e_0<2>)
+                     + x1 * mito::functions::constant<vector_t>(mito::tensor::e_1<2>);
+
+    // a matrix-valued function
+    constexpr auto A = mito::functions::dyadic(v, v) + mito::functions::identity<vector_t, 2>();
+
+    // its inverse
+    constexpr auto B = mito::functions::inverse(A);
+
+    // a batch of points
+    auto x = points(100);
+
+    // evaluate {B} on the batch
+    std::vector<typename decltype(B)::output_type> y(std::size(x));
+    mito::functions::evaluate(B, std::span<const vector_t>(x), std::span(y));
+
+    // check that the batched evaluation matches the evaluation point by point
+    for (int i = 0; i < std::ssize(x); ++i) {
+        EXPECT_TRUE(y[i] == B(x[i]));
+    }
+}
+
+
+// end of file
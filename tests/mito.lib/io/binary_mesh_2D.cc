@@ -0,0 +1,139 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/io.h>
+#include <mito/mesh.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+// the type of cell
+using cell_t = mito::geometry::triangle_t<2>;
+
+
+TEST(BinaryMesh, FromSummit)
+{
+    // convert the summit mesh to binary format
+    mito::io::binary::from_summit("rectangle.summit", "rectangle_binary");
+
+    // map the binary file
+    auto file = mito::io::binary::binary_mesh_t("rectangle_binary.mito");
+
+    // check the sizes
+    EXPECT_EQ(file.dim(), 2);
+    EXPECT_EQ(file.n_vertices(), 3);
+    EXPECT_EQ(file.n_nodes(), 1930);
+    EXPECT_EQ(file.n_cells(), 3690);
+    EXPECT_EQ(std::size(file.coordinates()), 2 * 1930);
+    EXPECT_EQ(std::size(file.connectivity()), 3 * 3690);
+
+    // check the first cell (summit line "3 1179 180 1195 1")
+    EXPECT_EQ(file.connectivity()[0], 1178);
+    EXPECT_EQ(file.connectivity()[1], 179);
+    EXPECT_EQ(file.connectivity()[2], 1194);
+
+    // check that the cell set ids are stored as tags, and that there are no partition ids
+    EXPECT_EQ(std::size(file.tags()), 3690);
+    for (auto tag : file.tags()) {
+        EXPECT_EQ(tag, 1);
+    }
+    EXPECT_TRUE(std::empty(file.partitions()));
+
+    // check that the coordinates of the first node are those in the summit file
+    EXPECT_DOUBLE_EQ(file.coordinates()[0], 0.0);
+    EXPECT_DOUBLE_EQ(file.coordinates()[1], 0.0);
+}
+
+
+TEST(BinaryMesh, RoundTrip)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // read the summit mesh
+    std::ifstream fileStream("rectangle.summit");
+    auto mesh = mito::io::summit::reader<cell_t>(fileStream, coord_system);
+
+    // tag the cells and assign them to two partitions
+    std::vector<std::int32_t> tags(mesh.nCells());
+    std::vector<std::int32_t> partitions(mesh.nCells());
+    for (int e = 0; e < mesh.nCells(); ++e) {
+        tags[e] = e;
+        partitions[e] = e % 2;
+    }
+
+    // write the mesh in binary format
+    mito::io::binary::writer("rectangle_roundtrip", mesh, coord_system, tags, partitions);
+
+    // read it back
+    auto file = mito::io::binary::binary_mesh_t("rectangle_roundtrip.mito");
+    auto reread = mito::io::binary::reader<cell_t>(file, coord_system);
+
+    // check that the mesh has the same cells and nodes
+    EXPECT_EQ(reread.nCells(), mesh.nCells());
+    EXPECT_EQ(mito::mesh::point_numbering(reread).size(), 1930);
+
+    // check that the tags and partition ids are preserved
+    EXPECT_TRUE(std::ranges::equal(file.tags(), tags));
+    EXPECT_TRUE(std::ranges::equal(file.partitions(), partitions));
+
+    // check that the cells have the same coordinates and tags, in the same order
+    auto cell = std::begin(mesh.cells());
+    int e = 0;
+    for (const auto & reread_cell : reread.cells()) {
+        EXPECT_EQ(reread.tag(reread_cell), tags[e++]);
+        for (int a = 0; a < cell_t::n_vertices; ++a) {
+            const auto & x = coord_system.coordinates(cell->nodes()[a]->point());
+            const auto & y = coord_system.coordinates(reread_cell.nodes()[a]->point());
+            EXPECT_DOUBLE_EQ(x[0], y[0]);
+            EXPECT_DOUBLE_EQ(x[1], y[1]);
+        }
+        ++cell;
+    }
+}
+
+
+TEST(BinaryMesh, WrongCellType)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // convert the summit mesh to binary format
+    mito::io::binary::from_summit("rectangle.summit", "rectangle_binary");
+
+    // expect reading triangles as segments to fail
+    EXPECT_THROW(
+        mito::io::binary::reader<mito::geometry::segment_t<2>>(
+            "rectangle_binary.mito", coord_system),
+        std::runtime_error);
+}
+
+
+TEST(BinaryMesh, CorruptedHeader)
+{
+    // convert the summit mesh to binary format
+    mito::io::binary::from_summit("rectangle.summit", "rectangle_binary");
+
+    // read it in memory
+    std::ifstream input("rectangle_binary.mito", std::ios::binary);
+    std::string bytes(std::istreambuf_iterator<char>(input), {});
+
+    // write a copy with an out of range tags flag in its header
+    std::int32_t has_tags = 2;
+    std::memcpy(
+        bytes.data() + offsetof(mito::io::binary::header_t, has_tags), &has_tags,
+        sizeof(has_tags));
+    std::ofstream output("rectangle_corrupted.mito", std::ios::binary);
+    output.write(bytes.data(), std::size(bytes));
+    output.close();
+
+    // expect mapping the copy to fail
+    EXPECT_THROW(mito::io::binary::binary_mesh_t("rectangle_corrupted.mito"), std::runtime_error);
+}
+
+
+// end of file
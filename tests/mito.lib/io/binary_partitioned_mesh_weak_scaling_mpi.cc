@@ -0,0 +1,157 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/simulation.h>
+#include <mito/mesh.h>
+#include <mito/io.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+// the type of cell
+using cell_t = mito::geometry::triangle_t<2>;
+
+// the number of squares per row and the number of rows per task (so that the work per task does
+// not depend on the number of tasks)
+constexpr int n_columns = 64;
+constexpr int n_rows = 64;
+
+
+// weak scaling of the partitioned mesh reader: run with e.g. {mpirun -n 8} to check that the time
+// to read the partition of a task does not grow with the number of tasks
+TEST(BinaryPartitionedMesh, WeakScaling)
+{
+    // the simulation representative
+    auto & simulation = mito::simulation::simulation();
+
+    // the number of tasks and the id of this task
+    int n_tasks = simulation.context().n_tasks();
+    int task_id = simulation.context().task_id();
+
+    // the number of cells per task
+    int n_cells = 2 * n_columns * n_rows;
+
+    // write the partitioned mesh of a strip with a slab of rows per task (serial preprocessing)
+    if (task_id == 0) {
+        // the coordinate system
+        auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+        // the mesh of the strip (the cells are generated row by row)
+        auto mesh = mito::mesh::generators::rectangle(
+            coord_system, n_columns, n_rows * n_tasks, { 0.0, 0.0 },
+            { 1.0, 1.0 * n_tasks });
+
+        // assign the slab of rows of each task to its part
+        std::vector<std::int32_t> partitions(mesh.nCells());
+        for (int e = 0; e < mesh.nCells(); ++e) {
+            partitions[e] = e / n_cells;
+        }
+
+        // write the partitioned mesh
+        mito::io::binary::partitioned_writer(
+            "strip_partitioned", mesh, coord_system, partitions, n_tasks);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // read the partition of this task only
+    double time = MPI_Wtime();
+    auto partition =
+        mito::io::binary::partitioned_reader<cell_t>("strip_partitioned.mitp", coord_system);
+    time = MPI_Wtime() - time;
+
+    // report the slowest read
+    double max_time = 0.0;
+    MPI_Allreduce(&time, &max_time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    if (task_id == 0) {
+        journal::info_t channel("tests.binary_partitioned_mesh");
+        channel << "read " << n_cells << " cells per task on " << n_tasks << " tasks in "
+                << max_time << " s" << journal::endl;
+    }
+
+    // expect each task to hold its own cells and one layer of ghost cells from each neighboring
+    // slab (the cells of the row next to it), regardless of the number of tasks
+    int n_neighbors = (task_id > 0) + (task_id < n_tasks - 1);
+    EXPECT_EQ(partition.n_owned_cells, n_cells);
+    EXPECT_EQ(partition.mesh.nCells(), n_cells + 2 * n_columns * n_neighbors);
+    for (int e = 0; e < partition.mesh.nCells(); ++e) {
+        EXPECT_EQ(partition.cell_owners[e], partition.cells[e] / n_cells);
+        EXPECT_EQ(e < partition.n_owned_cells, partition.cell_owners[e] == task_id);
+    }
+
+    // expect the nodes owned by each task to make up the nodes of the mesh
+    int n_owned = 0;
+    for (auto owner : partition.node_owners) {
+        n_owned += (owner == task_id);
+    }
+    MPI_Allreduce(MPI_IN_PLACE, &n_owned, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    EXPECT_EQ(n_owned, partition.n_nodes);
+    EXPECT_EQ(partition.n_nodes, (n_columns + 1) * (n_rows * n_tasks + 1));
+
+    // expect the ghost layer to hold all the cells of the nodes of the owned cells, by
+    // accumulating the valences of the nodes to their owners
+    auto node_halo = mito::mesh::distributed::node_halo(partition);
+    std::vector<double> valence(std::size(partition.nodes), 0.0);
+    for (int i = 0; i < 3 * partition.n_owned_cells; ++i) {
+        valence[partition.connectivity[i]] += 1.0;
+    }
+    node_halo.accumulate(valence);
+    node_halo.update(valence);
+    std::vector<double> local_valence(std::size(partition.nodes), 0.0);
+    for (auto node : partition.connectivity) {
+        local_valence[node] += 1.0;
+    }
+    for (int i = 0; i < 3 * partition.n_owned_cells; ++i) {
+        auto node = partition.connectivity[i];
+        EXPECT_DOUBLE_EQ(valence[node], local_valence[node]);
+    }
+
+    // expect the ghost cells to receive the global ids of their owners
+    auto cell_halo = mito::mesh::distributed::cell_halo(partition);
+    std::vector<double> ids(partition.mesh.nCells(), -1.0);
+    for (int e = 0; e < partition.n_owned_cells; ++e) {
+        ids[e] = partition.cells[e];
+    }
+    cell_halo.update(ids);
+    for (int e = 0; e < partition.mesh.nCells(); ++e) {
+        EXPECT_EQ(ids[e], partition.cells[e]);
+    }
+
+    // all done
+    return;
+}
+
+
+TEST(BinaryPartitionedMesh, WrongNumberOfParts)
+{
+    // the simulation representative
+    auto & simulation = mito::simulation::simulation();
+
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // write a partitioned mesh with one part more than the tasks
+    if (simulation.context().task_id() == 0) {
+        auto mesh = mito::mesh::generators::rectangle(
+            coord_system, 4, 4, { 0.0, 0.0 }, { 1.0, 1.0 });
+        std::vector<std::int32_t> partitions(mesh.nCells(), 0);
+        mito::io::binary::partitioned_writer(
+            "square_partitioned", mesh, coord_system, partitions,
+            simulation.context().n_tasks() + 1);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    // expect reading it to fail
+    EXPECT_THROW(
+        mito::io::binary::partitioned_reader<cell_t>("square_partitioned.mitp", coord_system),
+        std::runtime_error);
+}
+
+
+// end of file
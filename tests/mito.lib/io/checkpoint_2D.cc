@@ -0,0 +1,139 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+// simplicial cells in 2D
+using cell_t = mito::geometry::triangle_t<2>;
+// first degree finite elements
+constexpr int degree = 1;
+// assemble the finite element type
+using finite_element_t = mito::fem::isoparametric_simplex_t<degree, cell_t>;
+// the x scalar field in 2D
+constexpr auto x = mito::functions::component<coordinates_t, 0>;
+// the y scalar field in 2D
+constexpr auto y = mito::functions::component<coordinates_t, 1>;
+
+
+// a linear system that only keeps track of its size (no solver is needed to checkpoint a system)
+class linear_system_t {
+  public:
+    linear_system_t(std::string) {}
+    auto create(int n_equations) -> void { _n_equations = n_equations; }
+    auto n_equations() const -> int { return _n_equations; }
+
+  private:
+    int _n_equations = 0;
+};
+
+
+TEST(Checkpoint, Restart2D)
+{
+    // the number of elements, of constrained nodes and of equations of the original run
+    int n_elements = 0;
+    int n_constrained = 0;
+    int n_equations = 0;
+
+    {
+        // the coordinate system
+        auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+        // read the mesh of a square in 2D
+        std::ifstream fileStream("square.summit");
+        auto mesh = mito::io::summit::reader<cell_t>(fileStream, coord_system);
+
+        // create the body manifold
+        auto manifold = mito::manifolds::manifold(mesh, coord_system);
+
+        // set homogeneous Dirichlet boundary condition
+        auto boundary_mesh = mito::mesh::boundary(mesh);
+        auto zero = mito::functions::zero<coordinates_t>;
+        auto constraints = mito::constraints::dirichlet_bc(boundary_mesh, zero);
+
+        // the function space (linear elements on the manifold)
+        auto function_space = mito::fem::function_space<finite_element_t>(manifold, constraints);
+
+        // a linear field on the function space
+        auto field = function_space.fem_field<mito::tensor::scalar_t>("linear field");
+        for (const auto & [node, discretization_node] : function_space.node_map()) {
+            field(discretization_node) = (x + y)(coord_system.coordinates(node->point()));
+        }
+
+        // a discrete system on the function space
+        auto weakform = mito::fem::weakform<finite_element_t>();
+        auto discrete_system =
+            mito::fem::discrete_system<linear_system_t>("system", function_space, weakform);
+
+        // write the checkpoint
+        auto writer = mito::io::checkpoint::writer("square_checkpoint", manifold, function_space);
+        writer.record(field, "linear field");
+        writer.record(discrete_system, "system");
+        writer.write();
+
+        // keep track of the sizes of the original run
+        n_elements = std::size(function_space.elements());
+        n_constrained = std::size(function_space.constrained_nodes());
+        n_equations = discrete_system.n_equations();
+    }
+
+    // read the checkpoint back
+    auto checkpoint = mito::io::checkpoint::restart("square_checkpoint");
+
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // restore the mesh and build the manifold and the constraints on it
+    auto mesh = checkpoint.mesh<cell_t>(coord_system);
+    auto manifold = mito::manifolds::manifold(mesh, coord_system);
+    auto boundary_mesh = mito::mesh::boundary(mesh);
+    auto zero = mito::functions::zero<coordinates_t>;
+    auto constraints = mito::constraints::dirichlet_bc(boundary_mesh, zero);
+
+    // restore the function space
+    auto function_space = checkpoint.function_space<finite_element_t>(manifold, constraints);
+    EXPECT_EQ(std::size(function_space.elements()), n_elements);
+    EXPECT_EQ(std::size(function_space.constrained_nodes()), n_constrained);
+
+    // expect the restored constrained nodes to sit on the boundary of the restored mesh
+    for (const auto & cell : boundary_mesh.cells()) {
+        for (const auto & node : cell.nodes()) {
+            EXPECT_TRUE(
+                function_space.constrained_nodes().contains(function_space.node_map().at(node)));
+        }
+    }
+
+    // restore the field and expect it to be the same linear field
+    auto field = checkpoint.fem_field<mito::tensor::scalar_t>(function_space, "linear field");
+    for (const auto & [node, discretization_node] : function_space.node_map()) {
+        EXPECT_DOUBLE_EQ(
+            field(discretization_node), (x + y)(coord_system.coordinates(node->point())));
+    }
+
+    // restore the discrete system
+    auto weakform = mito::fem::weakform<finite_element_t>();
+    auto discrete_system =
+        checkpoint.discrete_system<linear_system_t>("system", function_space, weakform);
+    checkpoint.restore(function_space, discrete_system, "system");
+    EXPECT_EQ(discrete_system.n_equations(), n_equations);
+    EXPECT_EQ(discrete_system.linear_system().n_equations(), n_equations);
+
+    // expect the constrained nodes, and only them, to have no equation
+    for (const auto & [node, equation] : discrete_system.equation_map()) {
+        EXPECT_EQ(equation == -1, function_space.constrained_nodes().contains(node));
+    }
+
+    // expect the checkpoint to be rejected for a field that was not recorded
+    EXPECT_THROW(
+        checkpoint.fem_field<mito::tensor::scalar_t>(function_space, "missing"),
+        std::runtime_error);
+}
+
+
+// end of file
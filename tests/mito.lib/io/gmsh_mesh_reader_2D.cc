@@ -0,0 +1,115 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/io.h>
+#include <mito/mesh.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+// the type of cell
+using cell_t = mito::geometry::triangle_t<2>;
+
+
+// check the mesh and the physical groups read from the gmsh file {filename}
+auto
+check_physical_mesh(const std::string & filename) -> void
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // read the mesh with its physical groups
+    auto physical = mito::io::gmsh::physical_reader<cell_t>(filename, coord_system);
+    const auto & mesh = physical.mesh;
+
+    // check the cells and the nodes (the same as in square.summit)
+    EXPECT_EQ(mesh.nCells(), 242);
+    EXPECT_EQ(mito::mesh::point_numbering(mesh).size(), 142);
+
+    // check that the cells are tagged with the physical surface
+    for (const auto & cell : mesh.cells()) {
+        EXPECT_EQ(mesh.tag(cell), 1);
+    }
+
+    // check the names of the physical groups
+    EXPECT_EQ(physical.names.at(1), "square");
+    EXPECT_EQ(physical.group_names.at(2), "boundary");
+
+    // check that the physical curve is the boundary of the mesh
+    ASSERT_EQ(std::size(physical.groups), 1);
+    const auto & group = physical.groups.at(2);
+    auto boundary = mito::mesh::boundary(mesh);
+    EXPECT_EQ(group.nCells(), boundary.nCells());
+
+    // check that the physical curve shares the nodes of the boundary
+    using node_t = cell_t::node_type;
+    auto boundary_nodes = std::unordered_set<node_t, mito::utilities::hash_function<node_t>>();
+    for (const auto & segment : boundary.cells()) {
+        for (const auto & node : segment.nodes()) {
+            boundary_nodes.insert(node);
+        }
+    }
+    for (const auto & segment : group.cells()) {
+        for (const auto & node : segment.nodes()) {
+            EXPECT_TRUE(boundary_nodes.contains(node));
+        }
+    }
+
+    // all done
+    return;
+}
+
+
+TEST(GmshMeshReader, Ascii)
+{
+    check_physical_mesh("square.msh");
+}
+
+
+TEST(GmshMeshReader, Binary)
+{
+    check_physical_mesh("square_binary.msh");
+}
+
+
+TEST(GmshMeshReader, SameAsSummit)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // read the same mesh from the gmsh and the summit files
+    auto mesh = mito::io::gmsh::reader<cell_t>("square_binary.msh", coord_system);
+    std::ifstream fileStream("square.summit");
+    auto summit_mesh = mito::io::summit::reader<cell_t>(fileStream, coord_system);
+
+    // check that the cells have the same coordinates, in the same order
+    ASSERT_EQ(mesh.nCells(), summit_mesh.nCells());
+    auto cell = std::begin(summit_mesh.cells());
+    for (const auto & gmsh_cell : mesh.cells()) {
+        for (int a = 0; a < cell_t::n_vertices; ++a) {
+            const auto & x = coord_system.coordinates(cell->nodes()[a]->point());
+            const auto & y = coord_system.coordinates(gmsh_cell.nodes()[a]->point());
+            EXPECT_DOUBLE_EQ(x[0], y[0]);
+            EXPECT_DOUBLE_EQ(x[1], y[1]);
+        }
+        ++cell;
+    }
+}
+
+
+TEST(GmshMeshReader, MissingFile)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // expect reading a missing file to fail
+    EXPECT_THROW(
+        mito::io::gmsh::reader<cell_t>("missing.msh", coord_system), std::runtime_error);
+}
+
+
+// end of file
@@ -0,0 +1,76 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+
+#include <gtest/gtest.h>
+#include <mito/simulation.h>
+#include <mito/discrete.h>
+#include <mito/mesh.h>
+#include <mito/io.h>
+
+// cartesian coordinates in 3D
+using coordinates_t = mito::geometry::coordinates_t<3, mito::geometry::CARTESIAN>;
+
+
+TEST(ParallelVtuWriter, Mesh)
+{
+    // the simulation representative
+    auto & simulation = mito::simulation::simulation();
+
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // number of partitions
+    int n_partitions = simulation.context().n_tasks();
+
+    // expect 2 partitions
+    ASSERT_EQ(2, n_partitions);
+
+    // rank of the mesh to return
+    int n_rank = simulation.context().task_id();
+
+    // the mesh file to read
+    std::string mesh_file = (n_rank == 0 ? "top_half_ball.summit" : "bottom_half_ball.summit");
+
+    // read the mesh
+    std::ifstream fileStream(mesh_file);
+    auto mesh =
+        mito::io::summit::reader<mito::geometry::tetrahedron_t<3>>(fileStream, coord_system);
+
+    // write mesh to vtu files
+    mito::io::vtu::parallel_grid_writer("ball_mesh_vtu", mesh, coord_system).write();
+
+    // wait for all the pieces to be written
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    // expect the piece of this task to hold its cells
+    std::ifstream piece("ball_mesh_vtu_" + std::to_string(n_rank) + ".vtu");
+    std::string line;
+    bool found = false;
+    while (std::getline(piece, line)) {
+        if (line.find("NumberOfCells=\"" + std::to_string(mesh.nCells()) + "\"")
+            != std::string::npos) {
+            found = true;
+            break;
+        }
+    }
+    EXPECT_TRUE(found);
+
+    // expect the index to list the pieces of both tasks
+    std::ifstream index("ball_mesh_vtu.pvtu");
+    int n_pieces = 0;
+    while (std::getline(index, line)) {
+        if (line.find("<Piece Source=\"ball_mesh_vtu_") != std::string::npos) {
+            ++n_pieces;
+        }
+    }
+    EXPECT_EQ(n_pieces, 2);
+
+    // all done
+    return;
+}
+
+
+// end of file
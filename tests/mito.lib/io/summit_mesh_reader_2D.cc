@@ -28,3 +28,36 @@ TEST(SummitReader, Mesh2D)
     auto mesh = mito::io::summit::reader<mito::geometry::triangle_t<2>>(fileStream, coord_system);
     channel << "Loaded mesh in " << clock() - t << journal::endl;
 }
+
+
+TEST(SummitReader, CellSets)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // read the mesh
+    std::ifstream fileStream("rectangle.summit");
+    auto mesh = mito::io::summit::reader<mito::geometry::triangle_t<2>>(fileStream, coord_system);
+
+    // check that all the cells are read
+    EXPECT_EQ(mesh.nCells(), 3690);
+
+    // check that the nodes of the first cell (summit line "3 1179 180 1195 1") are in place
+    const auto & first = *std::begin(mesh.cells());
+    auto x = coord_system.coordinates(first.nodes()[1]->point());
+    std::ifstream reference("rectangle.summit");
+    std::string line;
+    for (int n = 0; n < 2 + 180; ++n) {
+        std::getline(reference, line);
+    }
+    double x_0 = 0.0;
+    double x_1 = 0.0;
+    std::istringstream(line) >> x_0 >> x_1;
+    EXPECT_DOUBLE_EQ(x[0], x_0);
+    EXPECT_DOUBLE_EQ(x[1], x_1);
+
+    // check that the cell set ids are stored as the tags of the cells
+    for (const auto & cell : mesh.cells()) {
+        EXPECT_EQ(mesh.tag(cell), 1);
+    }
+}
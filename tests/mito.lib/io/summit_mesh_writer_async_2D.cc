@@ -0,0 +1,85 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/io.h>
+#include <mito/mesh.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+// the type of cell
+using cell_t = mito::geometry::triangle_t<2>;
+
+
+// read the contents of file {filename}
+auto
+contents(std::string filename) -> std::string
+{
+    std::ifstream file(filename, std::ios::binary);
+    return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+}
+
+
+TEST(SummitWriter, Async)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // read the mesh
+    std::ifstream fileStream("rectangle.summit");
+    auto mesh = mito::io::summit::reader<cell_t>(fileStream, coord_system);
+
+    // write the mesh right away
+    mito::io::summit::writer("rectangle_sync", mesh, coord_system);
+
+    // write the mesh in the background (the writer is gone before the write is done)
+    auto done = mito::io::summit::async_writer("rectangle_async", mesh, coord_system);
+    done.get();
+
+    // expect the same file
+    EXPECT_EQ(contents("rectangle_async.summit"), contents("rectangle_sync.summit"));
+
+    // write a few steps in the background with the same writer
+    auto writer = mito::io::summit::mesh_writer_t("rectangle_steps", mesh, coord_system, "");
+    for (int step = 0; step < 4; ++step) {
+        writer.write_async();
+    }
+
+    // wait for the writes to be done
+    writer.wait();
+
+    // expect the same file
+    EXPECT_EQ(contents("rectangle_steps.summit"), contents("rectangle_sync.summit"));
+
+#ifdef WITH_VTK
+    // a mesh field with the x coordinate of the nodes
+    auto field = mito::discrete::mesh_field<mito::tensor::scalar_t>(mesh, "x");
+    for (auto & [node, value] : field) {
+        value = coord_system.coordinates(node->point())[0];
+    }
+
+    // write the field in the background
+    auto field_writer = mito::io::vtk::field_writer("rectangle_async", mesh, coord_system);
+    field_writer.record(field);
+    field_writer.write_async();
+
+    // attach new values of the field right away, while the previous ones are being written
+    for (auto & [node, value] : field) {
+        value = 0.0;
+    }
+    field_writer.record(field);
+
+    // wait for the write to be done
+    field_writer.wait();
+
+    // expect the file to be there
+    EXPECT_FALSE(contents("rectangle_async.vtu").empty());
+#endif    // WITH_VTK
+}
+
+
+// end of file
@@ -0,0 +1,150 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/io.h>
+#include <mito/mesh.h>
+#include <mito/discrete.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+// the type of cell
+using cell_t = mito::geometry::triangle_t<2>;
+
+
+// read the contents of file {filename}
+auto
+contents(std::string filename) -> std::string
+{
+    std::ifstream file(filename, std::ios::binary);
+    return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+}
+
+
+// the appended raw array at {offset} in the appended data section of {vtu}
+template <class T>
+auto
+appended(const std::string & vtu, std::size_t offset) -> std::vector<T>
+{
+    // the start of the appended data section
+    auto start = vtu.find('_', vtu.find("<AppendedData")) + 1;
+
+    // the size in bytes of the array
+    std::uint64_t size = 0;
+    std::memcpy(&size, vtu.data() + start + offset, sizeof(size));
+
+    // the array
+    std::vector<T> array(size / sizeof(T));
+    std::memcpy(array.data(), vtu.data() + start + offset + sizeof(size), size);
+
+    // all done
+    return array;
+}
+
+
+TEST(VtuWriter, Mesh2D)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // read the mesh
+    std::ifstream fileStream("rectangle.summit");
+    auto mesh = mito::io::summit::reader<cell_t>(fileStream, coord_system);
+
+    // a mesh field with the x coordinate of the nodes
+    auto field = mito::discrete::mesh_field<mito::tensor::scalar_t>(mesh, "x");
+    for (auto & [node, value] : field) {
+        value = coord_system.coordinates(node->point())[0];
+    }
+
+    // write the mesh and the field to a vtu file
+    auto writer = mito::io::vtu::field_writer("rectangle_vtu", mesh, coord_system);
+    writer.record(field);
+    writer.write();
+
+    // read the file back
+    auto vtu = contents("rectangle_vtu.vtu");
+
+    // check the size of the grid
+    EXPECT_NE(vtu.find("NumberOfPoints=\"1930\" NumberOfCells=\"3690\""), std::string::npos);
+
+    // the field is the first appended array, the points come next
+    auto x = appended<double>(vtu, 0);
+    auto points = appended<double>(vtu, sizeof(std::uint64_t) + 1930 * sizeof(double));
+    ASSERT_EQ(std::size(x), 1930);
+    ASSERT_EQ(std::size(points), 3 * 1930);
+
+    // check that the field is written at the points
+    for (int n = 0; n < 1930; ++n) {
+        EXPECT_DOUBLE_EQ(x[n], points[3 * n]);
+        EXPECT_DOUBLE_EQ(points[3 * n + 2], 0.0);
+    }
+
+#ifdef WITH_ZLIB
+    // write the mesh compressed
+    mito::io::vtu::grid_writer("rectangle_zlib", mesh, coord_system, mito::io::vtu::ZLIB).write();
+
+    // expect the compressed file to be declared as such, and to be smaller
+    auto compressed = contents("rectangle_zlib.vtu");
+    EXPECT_NE(compressed.find("compressor=\"vtkZLibDataCompressor\""), std::string::npos);
+    EXPECT_LT(std::size(compressed), std::size(vtu));
+#else
+    // expect compression to be unavailable
+    EXPECT_THROW(
+        mito::io::vtu::grid_writer("rectangle_zlib", mesh, coord_system, mito::io::vtu::ZLIB),
+        std::runtime_error);
+#endif    // WITH_ZLIB
+}
+
+
+TEST(VtuWriter, ContiguousField2D)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // read the mesh
+    std::ifstream fileStream("rectangle.summit");
+    auto mesh = mito::io::summit::reader<cell_t>(fileStream, coord_system);
+
+    // the writer
+    auto writer = mito::io::vtu::field_writer("rectangle_vtu_contiguous", mesh, coord_system);
+
+    // the coordinates of the points, stored contiguously in the order of the numbering of the
+    // points of the grid
+    const auto & numbering = writer.numbering();
+    std::vector<double> xy(2 * numbering.size());
+    for (int n = 0; n < numbering.size(); ++n) {
+        const auto & x = coord_system.coordinates(numbering.node(n)->point());
+        xy[2 * n] = x[0];
+        xy[2 * n + 1] = x[1];
+    }
+
+    // write the mesh and the coordinates, viewed in place
+    writer.record(xy, 2, "xy");
+    writer.write();
+
+    // read the file back
+    auto vtu = contents("rectangle_vtu_contiguous.vtu");
+
+    // the field is the first appended array, the points come next
+    auto values = appended<double>(vtu, 0);
+    auto points = appended<double>(vtu, sizeof(std::uint64_t) + 2 * 1930 * sizeof(double));
+    ASSERT_EQ(std::size(values), 2 * 1930);
+    ASSERT_EQ(std::size(points), 3 * 1930);
+
+    // check that the field is written at the points
+    for (int n = 0; n < 1930; ++n) {
+        EXPECT_DOUBLE_EQ(values[2 * n], points[3 * n]);
+        EXPECT_DOUBLE_EQ(values[2 * n + 1], points[3 * n + 1]);
+    }
+
+    // expect an array of the wrong size to be rejected
+    EXPECT_THROW(writer.record(xy, 3, "wrong"), std::runtime_error);
+}
+
+
+// end of file
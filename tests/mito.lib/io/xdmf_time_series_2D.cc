@@ -0,0 +1,110 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/io.h>
+#include <mito/mesh.h>
+#include <mito/discrete.h>
+#include <mito/simulation.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+// the type of cell
+using cell_t = mito::geometry::triangle_t<2>;
+
+
+// read the contents of file {filename}
+auto
+contents(std::string filename) -> std::string
+{
+    std::ifstream file(filename, std::ios::binary);
+    return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+}
+
+
+// count the occurrences of {pattern} in {text}
+auto
+count(const std::string & text, const std::string & pattern) -> int
+{
+    int result = 0;
+    for (auto pos = text.find(pattern); pos != std::string::npos;
+         pos = text.find(pattern, pos + 1)) {
+        ++result;
+    }
+    return result;
+}
+
+
+TEST(XdmfWriter, TimeSeries2D)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // read the mesh
+    std::ifstream fileStream("rectangle.summit");
+    auto mesh = mito::io::summit::reader<cell_t>(fileStream, coord_system);
+
+    // a mesh field and some cell values
+    auto field = mito::discrete::mesh_field<mito::tensor::scalar_t>(mesh, "u");
+    std::vector<double> pressure(mesh.nCells(), 0.0);
+
+    // the writer of the time series
+    auto writer = mito::io::xdmf::time_series_writer("rectangle_series", mesh, coord_system);
+    writer.record(field);
+    writer.record(pressure, 1, "p");
+
+    // the size of the mesh in the binary file (coordinates and connectivity)
+    auto mesh_size = (3 * 1930 + 3 * 3690) * sizeof(std::int64_t);
+    EXPECT_EQ(std::size(contents("rectangle_series.bin")), mesh_size);
+
+    // the simulation clock (starting at zero)
+    auto & simulation = mito::simulation::simulation();
+    ASSERT_EQ(simulation.clock(), 0.0);
+
+    // write a few steps
+    int n_steps = 4;
+    for (int step = 1; step <= n_steps; ++step) {
+        // update the values
+        for (auto & [node, value] : field) {
+            value = step * coord_system.coordinates(node->point())[0];
+        }
+        std::fill(std::begin(pressure), std::end(pressure), step);
+
+        // advance the clock and write the step
+        simulation.advance(0.25);
+        writer.write();
+
+        // expect each step to only add the values of the fields to the binary file
+        EXPECT_EQ(
+            std::size(contents("rectangle_series.bin")),
+            mesh_size + step * (1930 + 3690) * sizeof(double));
+    }
+    EXPECT_EQ(writer.n_steps(), n_steps);
+
+    // read the xdmf file back
+    auto xdmf = contents("rectangle_series.xdmf");
+
+    // expect one grid per step, with the time of the step, in a well closed file
+    EXPECT_EQ(count(xdmf, "GridType=\"Uniform\""), n_steps);
+    EXPECT_EQ(count(xdmf, "<Time Value="), n_steps);
+    EXPECT_NE(xdmf.find("<Time Value=\"0.25\"/>"), std::string::npos);
+    EXPECT_NE(xdmf.find("<Time Value=\"1\"/>"), std::string::npos);
+    EXPECT_EQ(count(xdmf, "</Xdmf>"), 1);
+    EXPECT_EQ(xdmf.substr(std::size(xdmf) - 8), "</Xdmf>\n");
+
+    // expect the mesh to be referenced from the same position at each step
+    EXPECT_EQ(count(xdmf, "Seek=\"0\""), n_steps);
+
+    // expect the last values of the field to be at the end of the binary file
+    auto bin = contents("rectangle_series.bin");
+    double last = 0.0;
+    std::memcpy(&last, bin.data() + std::size(bin) - sizeof(double), sizeof(double));
+    EXPECT_DOUBLE_EQ(last, n_steps);
+}
+
+
+// end of file
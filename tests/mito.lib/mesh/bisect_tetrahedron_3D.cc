@@ -0,0 +1,62 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/mesh.h>
+#include <mito/manifolds.h>
+
+
+// cartesian coordinates in 3D
+using coordinates_t = mito::geometry::coordinates_t<3, mito::geometry::CARTESIAN>;
+
+
+TEST(Bisect, Tetrahedron3D)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // generate a mesh of the unit cube
+    auto mesh = mito::mesh::generators::box(
+        coord_system, 3, 3, 3, { 0.0, 0.0, 0.0 }, { 1.0, 1.0, 1.0 });
+
+    // refine the cells close to the origin
+    auto marker = [&coord_system](const auto & cell) {
+        auto x = mito::geometry::barycenter(cell, coord_system);
+        return x[0] * x[0] + x[1] * x[1] + x[2] * x[2] < 0.1;
+    };
+    auto refinement = mito::mesh::bisect(mesh, coord_system, marker);
+    const auto & refined_mesh = refinement.mesh;
+
+    // expect more cells than the original mesh but fewer than a uniform refinement
+    EXPECT_GT(refined_mesh.nCells(), mesh.nCells());
+    EXPECT_LT(refined_mesh.nCells(), 8 * mesh.nCells());
+
+    // expect all children to be accounted for
+    int n_children = 0;
+    for (const auto & children : refinement.children) {
+        n_children += std::ssize(children);
+    }
+    EXPECT_EQ(n_children, refined_mesh.nCells());
+
+    // expect the (positively oriented) cells to fill the unit cube
+    EXPECT_NEAR(mito::manifolds::manifold(refined_mesh, coord_system).volume(), 1.0, 1.e-13);
+
+    // expect no hanging nodes: all boundary triangles lie on the boundary of the unit cube
+    auto boundary_mesh = mito::mesh::boundary(refined_mesh);
+    for (const auto & cell : boundary_mesh.cells()) {
+        auto x = mito::geometry::barycenter(cell, coord_system);
+        bool on_boundary = false;
+        for (int d = 0; d < 3; ++d) {
+            on_boundary |= std::abs(x[d]) < 1.e-14 || std::abs(x[d] - 1.0) < 1.e-14;
+        }
+        EXPECT_TRUE(on_boundary);
+    }
+
+    // all done
+    return;
+}
+
+
+// end of file
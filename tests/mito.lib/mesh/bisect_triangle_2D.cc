@@ -0,0 +1,74 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/mesh.h>
+#include <mito/manifolds.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+
+TEST(Bisect, Triangle2D)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // generate a mesh of the unit square
+    auto mesh = mito::mesh::generators::rectangle(coord_system, 4, 4, { 0.0, 0.0 }, { 1.0, 1.0 });
+
+    // refine the cells close to the origin
+    auto marker = [&coord_system](const auto & cell) {
+        auto x = mito::geometry::barycenter(cell, coord_system);
+        return x[0] * x[0] + x[1] * x[1] < 0.1;
+    };
+    auto refinement = mito::mesh::bisect(mesh, coord_system, marker);
+    const auto & refined_mesh = refinement.mesh;
+
+    // expect more cells than the original mesh but fewer than a uniform refinement
+    EXPECT_GT(refined_mesh.nCells(), mesh.nCells());
+    EXPECT_LT(refined_mesh.nCells(), 4 * mesh.nCells());
+
+    // expect each original cell to have at least one child and all children to be accounted for
+    int n_children = 0;
+    for (const auto & children : refinement.children) {
+        EXPECT_GE(std::ssize(children), 1);
+        n_children += std::ssize(children);
+    }
+    EXPECT_EQ(std::ssize(refinement.children), mesh.nCells());
+    EXPECT_EQ(n_children, refined_mesh.nCells());
+
+    // expect the (positively oriented) cells to cover the unit square
+    EXPECT_NEAR(mito::manifolds::manifold(refined_mesh, coord_system).volume(), 1.0, 1.e-13);
+
+    // expect no hanging nodes: all boundary segments lie on the boundary of the unit square
+    auto boundary_mesh = mito::mesh::boundary(refined_mesh);
+    for (const auto & cell : boundary_mesh.cells()) {
+        auto x = mito::geometry::barycenter(cell, coord_system);
+        bool on_boundary = std::abs(x[0]) < 1.e-14 || std::abs(x[0] - 1.0) < 1.e-14
+                        || std::abs(x[1]) < 1.e-14 || std::abs(x[1] - 1.0) < 1.e-14;
+        EXPECT_TRUE(on_boundary);
+    }
+
+    // refine once more with an indicator listed per cell
+    std::vector<double> indicators;
+    for (const auto & cell : refined_mesh.cells()) {
+        auto x = mito::geometry::barycenter(cell, coord_system);
+        indicators.push_back(1.0 / (0.01 + x[0] * x[0] + x[1] * x[1]));
+    }
+    auto refinement_2 = mito::mesh::bisect(refined_mesh, coord_system, indicators, 0.5);
+
+    // expect more cells and the same area
+    EXPECT_GT(refinement_2.mesh.nCells(), refined_mesh.nCells());
+    EXPECT_NEAR(
+        mito::manifolds::manifold(refinement_2.mesh, coord_system).volume(), 1.0, 1.e-13);
+
+    // all done
+    return;
+}
+
+
+// end of file
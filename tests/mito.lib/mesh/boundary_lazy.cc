@@ -0,0 +1,62 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/mesh.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+
+TEST(Mesh, BoundaryLazy)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // build the nodes of the unit square and of its center
+    auto node_0 = mito::geometry::node(coord_system, { 0.0, 0.0 });
+    auto node_1 = mito::geometry::node(coord_system, { 1.0, 0.0 });
+    auto node_2 = mito::geometry::node(coord_system, { 1.0, 1.0 });
+    auto node_3 = mito::geometry::node(coord_system, { 0.0, 1.0 });
+    auto node_4 = mito::geometry::node(coord_system, { 0.5, 0.5 });
+
+    // an empty mesh of triangles in 2D
+    auto mesh = mito::mesh::mesh<mito::geometry::triangle_t<2>>();
+
+    // insert two triangles
+    mesh.insert({ node_0, node_1, node_4 });
+    mesh.insert({ node_1, node_2, node_4 });
+
+    // the first boundary query builds the orientation map
+    EXPECT_EQ(mito::mesh::boundary_size(mesh), 4);
+
+    // insert the other two triangles after the query (the map is kept up to date)
+    mesh.insert({ node_2, node_3, node_4 });
+    auto & cell = mesh.insert({ node_3, node_0, node_4 });
+
+    // the boundary is now the boundary of the square
+    EXPECT_EQ(mito::mesh::boundary_size(mesh), 4);
+
+    // erase a triangle
+    mesh.erase(cell);
+
+    // the boundary gains one segment
+    EXPECT_EQ(mito::mesh::boundary_size(mesh), 5);
+
+    // insert a duplicate of a triangle and remove it (the map is rebuilt on the next query)
+    mesh.insert({ node_0, node_1, node_4 });
+    mesh.erase_geometrical_duplicates();
+
+    // the boundary is unchanged
+    EXPECT_EQ(mesh.nCells(), 3);
+    EXPECT_EQ(mito::mesh::boundary_size(mesh), 5);
+
+    // all done
+    return;
+}
+
+
+// end of file
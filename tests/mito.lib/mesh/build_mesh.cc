@@ -61,3 +61,43 @@ TEST(Mesh, BuildMesh)
     // all done
     return;
 }
+
+
+TEST(Mesh, BuildMeshFromConnectivity)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // an empty mesh of simplicial topology in 2D
+    auto mesh = mito::mesh::mesh<mito::geometry::triangle_t<2>>();
+
+    // the nodes of the mesh of {BuildMesh}
+    std::vector<mito::geometry::node_t<2>> nodes = {
+        mito::geometry::node(coord_system, { 0.0, 0.0 }),
+        mito::geometry::node(coord_system, { 1.0, 0.0 }),
+        mito::geometry::node(coord_system, { 1.0, 1.0 }),
+        mito::geometry::node(coord_system, { 0.5, 0.5 }),
+        mito::geometry::node(coord_system, { 0.0, 1.0 })
+    };
+
+    // insert all the triangles at once, with a tag each
+    std::vector<int> connectivity = { 0, 1, 3, 1, 2, 3, 2, 4, 3, 4, 0, 3 };
+    std::vector<int> tags = { 1, 2, 0, 4 };
+    mesh.insert(nodes, connectivity, tags);
+
+    // assert you built 4 cells, with their tags and with 4 cells (segments) on the boundary
+    EXPECT_EQ(mesh.nCells(), 4);
+    int e = 0;
+    for (const auto & cell : mesh.cells()) {
+        EXPECT_EQ(mesh.tag(cell), tags[e++]);
+    }
+    EXPECT_EQ(mito::mesh::boundary(mesh).nCells(), 4);
+
+    // a connectivity referring to a missing node is rejected, without inserting any cell
+    std::vector<int> bad = { 0, 1, 2, 0, 1, 5 };
+    EXPECT_THROW(mesh.insert(nodes, bad), std::runtime_error);
+    EXPECT_EQ(mesh.nCells(), 4);
+
+    // all done
+    return;
+}
@@ -0,0 +1,103 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/mesh.h>
+#include <mito/io.h>
+#include <mito/simulation.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+// the type of cell
+using cell_t = mito::geometry::triangle_t<2>;
+
+
+TEST(DistributedPartition, GhostLayer)
+{
+    // the simulation representative
+    auto & simulation = mito::simulation::simulation();
+
+    // the id of this task
+    int task_id = simulation.context().task_id();
+
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // read the mesh in blocks, partition it and migrate the cells to their partition
+    auto partition = mito::io::summit::distributed_reader<cell_t>("rectangle.summit", coord_system);
+
+    // add a layer of ghost cells
+    mito::mesh::distributed::ghost(partition, coord_system, 1);
+
+    // the number of nodes of the partition
+    int n_nodes = std::size(partition.nodes);
+
+    // expect the nodes owned by each task to be numbered contiguously, and all the nodes of the
+    // mesh to be numbered
+    int n_owned = 0;
+    int n_cells = partition.n_owned_cells;
+    for (int n = 0; n < n_nodes; ++n) {
+        if (partition.node_owners[n] == task_id) {
+            ++n_owned;
+        }
+    }
+    MPI_Allreduce(MPI_IN_PLACE, &n_owned, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, &n_cells, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    EXPECT_EQ(n_owned, partition.n_nodes);
+    for (auto number : partition.node_numbers) {
+        EXPECT_GE(number, 0);
+        EXPECT_LT(number, partition.n_nodes);
+    }
+
+    // count the owned cells of each node and accumulate the counts to the owners of the nodes
+    auto node_halo = mito::mesh::distributed::node_halo(partition);
+    std::vector<double> valence(n_nodes, 0.0);
+    for (int i = 0; i < 3 * partition.n_owned_cells; ++i) {
+        valence[partition.connectivity[i]] += 1.0;
+    }
+    node_halo.accumulate(valence);
+    node_halo.update(valence);
+
+    // count the (owned or ghost) cells of each node in this partition
+    std::vector<double> local_valence(n_nodes, 0.0);
+    for (auto node : partition.connectivity) {
+        local_valence[node] += 1.0;
+    }
+
+    // expect that the ghost layer holds all the cells of the nodes of the owned cells
+    for (int i = 0; i < 3 * partition.n_owned_cells; ++i) {
+        auto node = partition.connectivity[i];
+        EXPECT_DOUBLE_EQ(valence[node], local_valence[node]);
+    }
+
+    // expect the sum of the valences of the nodes to count each cell three times
+    double total = 0.0;
+    for (int n = 0; n < n_nodes; ++n) {
+        if (partition.node_owners[n] == task_id) {
+            total += valence[n];
+        }
+    }
+    MPI_Allreduce(MPI_IN_PLACE, &total, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    EXPECT_DOUBLE_EQ(total, 3.0 * n_cells);
+
+    // expect the ghost cells to receive the values of their owners
+    auto cell_halo = mito::mesh::distributed::cell_halo(partition);
+    std::vector<double> ids(partition.mesh.nCells(), -1.0);
+    for (int e = 0; e < partition.n_owned_cells; ++e) {
+        ids[e] = partition.cells[e];
+    }
+    cell_halo.update(ids);
+    for (int e = 0; e < partition.mesh.nCells(); ++e) {
+        EXPECT_EQ(ids[e], partition.cells[e]);
+    }
+
+    // all done
+    return;
+}
+
+
+// end of file
@@ -0,0 +1,87 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/mesh.h>
+#include <mito/io.h>
+#include <mito/manifolds.h>
+#include <mito/simulation.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+// the type of cell
+using cell_t = mito::geometry::triangle_t<2>;
+
+
+TEST(DistributedPartition, Hilbert)
+{
+    // the simulation representative
+    auto & simulation = mito::simulation::simulation();
+
+    // the number of tasks
+    int n_tasks = simulation.context().n_tasks();
+
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // read a block of cells of the mesh on each task
+    auto block = mito::io::summit::block_reader<cell_t>("rectangle.summit");
+
+    // expect the blocks to cover the mesh
+    int n_cells = block.size();
+    MPI_Allreduce(MPI_IN_PLACE, &n_cells, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    EXPECT_EQ(n_cells, block.n_cells);
+
+    // partition the cells along a Hilbert curve and send them to their partition
+    auto painting = mito::mesh::distributed::paint_hilbert(block);
+    auto partition = mito::mesh::distributed::migrate(block, painting, coord_system);
+
+    // expect the partitions to cover the mesh
+    int n_local_cells = partition.mesh.nCells();
+    int n_partitioned_cells = n_local_cells;
+    MPI_Allreduce(MPI_IN_PLACE, &n_partitioned_cells, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    EXPECT_EQ(n_partitioned_cells, block.n_cells);
+
+    // expect the partitions to be balanced
+    EXPECT_LE(n_local_cells, 1.05 * block.n_cells / n_tasks);
+
+    // expect one global id per cell and one node per global node id
+    EXPECT_EQ(std::ssize(partition.cells), n_local_cells);
+    EXPECT_EQ(std::size(partition.nodes), std::size(partition.node_ids));
+
+    // all done
+    return;
+}
+
+
+TEST(DistributedPartition, SummitReader)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // read the mesh in blocks, partition it and migrate the cells to their partition
+    auto partition = mito::io::summit::distributed_reader<cell_t>("rectangle.summit", coord_system);
+
+    // the area of the partition of this task
+    double area = mito::manifolds::manifold(partition.mesh, coord_system).volume();
+    MPI_Allreduce(MPI_IN_PLACE, &area, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+    // the area of the whole mesh, read serially
+    auto serial_coord_system = mito::geometry::coordinate_system<coordinates_t>();
+    std::ifstream fileStream("rectangle.summit");
+    auto mesh = mito::io::summit::reader<cell_t>(fileStream, serial_coord_system);
+    double expected = mito::manifolds::manifold(mesh, serial_coord_system).volume();
+
+    // expect the partitions to cover the mesh
+    EXPECT_NEAR(area, expected, 1.e-12);
+
+    // all done
+    return;
+}
+
+
+// end of file
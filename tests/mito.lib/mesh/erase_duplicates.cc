@@ -3,6 +3,9 @@
 // Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
 //
 
+#include <algorithm>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include <mito/mesh.h>
 
@@ -69,3 +72,62 @@ TEST(Mesh, EraseDuplicates)
     // all done
     return;
 }
+
+
+// the sorted tags of the cells of {mesh}
+auto
+sorted_tags(const auto & mesh)
+{
+    std::vector<int> tags;
+    for (const auto & cell : mesh.cells()) {
+        tags.push_back(mesh.tag(cell));
+    }
+    std::sort(std::begin(tags), std::end(tags));
+
+    // all done
+    return tags;
+}
+
+
+TEST(Mesh, EraseDuplicatesTags)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // an empty mesh of simplicial topology in 2D
+    auto mesh = mito::mesh::mesh<mito::geometry::triangle_t<2>>();
+
+    // build nodes
+    auto node_0 = mito::geometry::node(coord_system, { 0.0, 0.0 });
+    auto node_1 = mito::geometry::node(coord_system, { 1.0, 0.0 });
+    auto node_2 = mito::geometry::node(coord_system, { 1.0, 1.0 });
+    auto node_3 = mito::geometry::node(coord_system, { 0.0, 1.0 });
+
+    // insert a triangle, a geometrical duplicate, a topological duplicate and another triangle,
+    // each with its own tag
+    mesh.tag(mesh.insert({ node_0, node_1, node_2 }), 1);
+    auto & duplicate = mesh.insert({ node_0, node_1, node_2 });
+    mesh.tag(duplicate, 2);
+    mesh.tag(mesh.insert({ node_1, node_0, node_2 }), 3);
+    mesh.tag(mesh.insert({ node_0, node_2, node_3 }), 4);
+
+    // erasing the geometrical duplicate leaves the tag of the cell sharing its simplex
+    mesh.erase(duplicate);
+    EXPECT_EQ(sorted_tags(mesh), std::vector<int>({ 1, 3, 4 }));
+
+    // insert the geometrical duplicate again, and erase geometrical duplicates
+    mesh.tag(mesh.insert({ node_0, node_1, node_2 }), 2);
+    mesh.erase_geometrical_duplicates();
+    EXPECT_EQ(sorted_tags(mesh), std::vector<int>({ 1, 3, 4 }));
+
+    // erase topological duplicates
+    mesh.erase_topological_duplicates();
+    EXPECT_EQ(sorted_tags(mesh), std::vector<int>({ 1, 4 }));
+
+    // a cell inserted in the place of an erased cell is untagged
+    mesh.insert({ node_1, node_2, node_3 });
+    EXPECT_EQ(sorted_tags(mesh), std::vector<int>({ 0, 1, 4 }));
+
+    // all done
+    return;
+}
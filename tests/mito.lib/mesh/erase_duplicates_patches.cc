@@ -0,0 +1,88 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/mesh.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+
+TEST(Mesh, EraseDuplicatesPatches)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // an empty mesh of simplicial topology in 2D
+    auto mesh = mito::mesh::mesh<mito::geometry::triangle_t<2>>();
+
+    // the number of squares per side of the patch
+    const int n = 30;
+
+    // build the nodes of a structured grid
+    std::vector<mito::geometry::node_t<2>> nodes;
+    for (int j = 0; j <= n; ++j) {
+        for (int i = 0; i <= n; ++i) {
+            nodes.push_back(mito::geometry::node(coord_system, { 1.0 * i / n, 1.0 * j / n }));
+        }
+    }
+
+    // insert the same patch of triangles three times, as if stitching overlapping patches
+    for (int copy = 0; copy < 3; ++copy) {
+        for (int j = 0; j < n; ++j) {
+            for (int i = 0; i < n; ++i) {
+                auto node = [&](int a, int b) { return nodes[(j + b) * (n + 1) + i + a]; };
+                mesh.insert({ node(0, 0), node(1, 0), node(1, 1) });
+                mesh.insert({ node(0, 0), node(1, 1), node(0, 1) });
+            }
+        }
+    }
+
+    // insert each triangle once more with a different (but equally oriented) node ordering
+    for (int j = 0; j < n; ++j) {
+        for (int i = 0; i < n; ++i) {
+            auto node = [&](int a, int b) { return nodes[(j + b) * (n + 1) + i + a]; };
+            mesh.insert({ node(1, 0), node(1, 1), node(0, 0) });
+            mesh.insert({ node(1, 1), node(0, 1), node(0, 0) });
+        }
+    }
+
+    // expect to find four copies of the patch in the mesh
+    EXPECT_EQ(mesh.nCells(), 4 * 2 * n * n);
+
+    // erase geometrical duplicates
+    mesh.erase_geometrical_duplicates();
+
+    // expect to find one copy of the patch
+    EXPECT_EQ(mesh.nCells(), 2 * n * n);
+
+    // expect the boundary of the patch to be the boundary of the unit square
+    EXPECT_EQ(mito::mesh::boundary_size(mesh), 4 * n);
+
+    // insert the patch with opposite orientation
+    for (int j = 0; j < n; ++j) {
+        for (int i = 0; i < n; ++i) {
+            auto node = [&](int a, int b) { return nodes[(j + b) * (n + 1) + i + a]; };
+            mesh.insert({ node(1, 0), node(0, 0), node(1, 1) });
+            mesh.insert({ node(1, 1), node(0, 0), node(0, 1) });
+        }
+    }
+
+    // erase topological duplicates
+    mesh.erase_topological_duplicates();
+
+    // expect to find one copy of the patch
+    EXPECT_EQ(mesh.nCells(), 2 * n * n);
+
+    // expect the boundary of the patch to be the boundary of the unit square
+    EXPECT_EQ(mito::mesh::boundary_size(mesh), 4 * n);
+
+    // all done
+    return;
+}
+
+
+// end of file
@@ -0,0 +1,39 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/mesh.h>
+#include <mito/manifolds.h>
+
+
+// cartesian coordinates in 3D
+using coordinates_t = mito::geometry::coordinates_t<3, mito::geometry::CARTESIAN>;
+
+
+TEST(Generators, Box)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // generate a mesh of the box [0, 1] x [0, 2] x [0, 3] with 4 x 3 x 2 cubes
+    auto mesh = mito::mesh::generators::box(
+        coord_system, 4, 3, 2, { 0.0, 0.0, 0.0 }, { 1.0, 2.0, 3.0 });
+
+    // expect six tetrahedra per cube
+    EXPECT_EQ(mesh.nCells(), 6 * 4 * 3 * 2);
+
+    // expect a conforming mesh whose boundary is the boundary of the box (two triangles per
+    // boundary face of each cube)
+    EXPECT_EQ(mito::mesh::boundary_size(mesh), 2 * 2 * (4 * 3 + 3 * 2 + 2 * 4));
+
+    // expect the (positively oriented) tetrahedra to fill the volume of the box
+    EXPECT_NEAR(mito::manifolds::manifold(mesh, coord_system).volume(), 6.0, 1.e-13);
+
+    // all done
+    return;
+}
+
+
+// end of file
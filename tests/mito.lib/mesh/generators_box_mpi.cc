@@ -0,0 +1,51 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/simulation.h>
+#include <mito/mesh.h>
+#include <mito/manifolds.h>
+
+
+// cartesian coordinates in 3D
+using coordinates_t = mito::geometry::coordinates_t<3, mito::geometry::CARTESIAN>;
+
+
+TEST(Generators, BoxMPI)
+{
+    // the simulation representative
+    auto & simulation = mito::simulation::simulation();
+
+    // the number of tasks and the id of this task
+    int n_tasks = simulation.context().n_tasks();
+    int task_id = simulation.context().task_id();
+
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // generate the slab of this task of a mesh of the unit cube with 3 x 3 x 4 cubes
+    auto mesh = mito::mesh::generators::box(
+        coord_system, 3, 3, 4, { 0.0, 0.0, 0.0 }, { 1.0, 1.0, 1.0 }, n_tasks, task_id);
+
+    // the number of cells and the volume of the slab of this task
+    int n_cells = mesh.nCells();
+    double volume = mito::manifolds::manifold(mesh, coord_system).volume();
+
+    // sum over the tasks
+    int total_cells = 0;
+    MPI_Allreduce(&n_cells, &total_cells, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    double total_volume = 0.0;
+    MPI_Allreduce(&volume, &total_volume, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+    // expect the slabs to make up the whole mesh
+    EXPECT_EQ(total_cells, 6 * 3 * 3 * 4);
+    EXPECT_NEAR(total_volume, 1.0, 1.e-13);
+
+    // all done
+    return;
+}
+
+
+// end of file
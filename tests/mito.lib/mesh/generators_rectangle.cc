@@ -0,0 +1,38 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/mesh.h>
+#include <mito/manifolds.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+
+TEST(Generators, Rectangle)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // generate a mesh of the rectangle [0, 2] x [0, 1] with 8 x 3 squares
+    auto mesh =
+        mito::mesh::generators::rectangle(coord_system, 8, 3, { 0.0, 0.0 }, { 2.0, 1.0 });
+
+    // expect two triangles per square
+    EXPECT_EQ(mesh.nCells(), 2 * 8 * 3);
+
+    // expect a conforming mesh whose boundary is the boundary of the rectangle
+    EXPECT_EQ(mito::mesh::boundary_size(mesh), 2 * (8 + 3));
+
+    // expect the (positively oriented) triangles to cover the area of the rectangle
+    EXPECT_NEAR(mito::manifolds::manifold(mesh, coord_system).volume(), 2.0, 1.e-13);
+
+    // all done
+    return;
+}
+
+
+// end of file
@@ -0,0 +1,56 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+
+#include <gtest/gtest.h>
+#include <mito/mesh.h>
+#include <mito/io.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+
+TEST(MetisPartitioner, AllPartitions)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // load mesh
+    std::ifstream fileStream("rectangle.summit");
+    auto mesh = mito::io::summit::reader<mito::geometry::triangle_t<2>>(fileStream, coord_system);
+
+    // number of partitions
+    int n_partitions = 4;
+
+    // paint the mesh once
+    auto painting = mito::mesh::metis::paint(mesh, n_partitions);
+
+    // expect one color per cell, each in the range of partitions
+    EXPECT_EQ(std::size(painting), mesh.nCells());
+    for (auto color : painting) {
+        EXPECT_GE(color, 0);
+        EXPECT_LT(color, n_partitions);
+    }
+
+    // partition the mesh once in all its partitions
+    auto partitions = mito::mesh::metis::partition(mesh, n_partitions);
+    EXPECT_EQ(std::size(partitions), n_partitions);
+
+    // expect that the partitions cover the original mesh and match the single-rank partitions
+    int n_cells = 0;
+    for (int rank = 0; rank < n_partitions; ++rank) {
+        n_cells += partitions[rank].nCells();
+        auto partition = mito::mesh::metis::partition(mesh, n_partitions, rank);
+        EXPECT_EQ(partitions[rank].nCells(), partition.nCells());
+    }
+    EXPECT_EQ(n_cells, mesh.nCells());
+
+    // all done
+    return;
+}
+
+
+// end of file
@@ -0,0 +1,65 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/mesh.h>
+#include <mito/io.h>
+#include <mito/manifolds.h>
+#include <mito/simulation.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+// the type of cell
+using cell_t = mito::geometry::triangle_t<2>;
+
+
+TEST(MetisPartitionerMPI, Scatter)
+{
+    // the simulation representative
+    auto & simulation = mito::simulation::simulation();
+
+    // the rank of this task
+    int n_rank = simulation.context().task_id();
+
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // load mesh on the root task only
+    auto load_mesh = [&coord_system](int rank) {
+        if (rank != 0) {
+            return mito::mesh::mesh<cell_t>();
+        }
+        std::ifstream fileStream("rectangle.summit");
+        return mito::io::summit::reader<cell_t>(fileStream, coord_system);
+    };
+    auto mesh = load_mesh(n_rank);
+
+    // partition the mesh on the root task and send each task its partition
+    auto mesh_partition = mito::mesh::metis::scatter(mesh, coord_system);
+
+    // the number of cells and the area of this partition
+    int local_ncells = mesh_partition.nCells();
+    double local_area = mito::manifolds::manifold(mesh_partition, coord_system).volume();
+
+    // the global (reduced) number of cells and area of all partitions
+    int global_ncells = 0;
+    MPI_Reduce(&local_ncells, &global_ncells, 1, MPI_INT, MPI_SUM, 0, MPI_COMM_WORLD);
+    double global_area = 0.0;
+    MPI_Reduce(&local_area, &global_area, 1, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+
+    // expect that the partitions cover the original mesh
+    if (n_rank == 0) {
+        EXPECT_EQ(global_ncells, mesh.nCells());
+        EXPECT_NEAR(global_area, mito::manifolds::manifold(mesh, coord_system).volume(), 1.e-13);
+    }
+
+    // all done
+    return;
+}
+
+
+// end of file
@@ -0,0 +1,115 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+
+#include <gtest/gtest.h>
+#include <mito/mesh.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+
+TEST(MetisPartitioner, Weighted)
+{
+    // make a channel
+    journal::info_t channel("tests.partitioner");
+
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // generate a mesh of the rectangle [0, 2] x [0, 1] with 40 x 20 squares
+    auto mesh =
+        mito::mesh::generators::rectangle(coord_system, 40, 20, { 0.0, 0.0 }, { 2.0, 1.0 });
+
+    // the cells on the left half of the rectangle are four times as expensive
+    auto weight = [&coord_system](const auto & cell) -> int {
+        const auto & x = coord_system.coordinates(cell.nodes()[0]->point());
+        return x[0] < 1.0 ? 4 : 1;
+    };
+
+    // number of partitions
+    int n_partitions = 4;
+
+    // paint the mesh balancing the weights of the cells
+    auto constraints = mito::mesh::metis::constraints(mesh, weight, 1.05);
+    auto painting = mito::mesh::metis::paint(mesh, n_partitions, constraints);
+
+    // expect an integer imbalance to be taken for the imbalance, not for the communication sizes
+    auto integer_imbalance = mito::mesh::metis::constraints(mesh, weight, 2);
+    EXPECT_EQ(integer_imbalance.imbalance, 2.0);
+    EXPECT_TRUE(std::empty(integer_imbalance.sizes));
+
+    // the total weight of the mesh
+    int total = 0;
+    for (const auto & cell : mesh.cells()) {
+        total += weight(cell);
+    }
+
+    // report
+    channel << "Edgecut = " << painting.edgecut << journal::endl;
+    for (int part = 0; part < n_partitions; ++part) {
+        channel << "Load " << part << " = " << painting.loads[part] << journal::endl;
+    }
+
+    // expect one partition per cell, a nontrivial edgecut and loads adding up to the total weight
+    EXPECT_EQ(std::size(painting.parts), mesh.nCells());
+    EXPECT_GT(painting.edgecut, 0);
+    EXPECT_EQ(std::size(painting.loads), n_partitions);
+    EXPECT_EQ(std::accumulate(std::begin(painting.loads), std::end(painting.loads), 0), total);
+
+    // expect the loads to be balanced (an unweighted partition in four stripes would load two
+    // partitions with 1.6 times the average load)
+    for (auto load : painting.loads) {
+        EXPECT_LE(load, 1.2 * total / n_partitions);
+    }
+
+    // all done
+    return;
+}
+
+
+TEST(MetisPartitioner, MultiConstraint)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // generate a mesh of the rectangle [0, 2] x [0, 1] with 40 x 20 squares
+    auto mesh =
+        mito::mesh::generators::rectangle(coord_system, 40, 20, { 0.0, 0.0 }, { 2.0, 1.0 });
+
+    // balance both the number of cells and the number of cells in the left half
+    auto weight = [&coord_system](const auto & cell) -> std::array<int, 2> {
+        const auto & x = coord_system.coordinates(cell.nodes()[0]->point());
+        return { 1, x[0] < 1.0 ? 1 : 0 };
+    };
+
+    // number of partitions
+    int n_partitions = 4;
+
+    // partition the mesh with two constraints and unit communication sizes
+    auto constraints = mito::mesh::metis::constraints(
+        mesh, weight, [](const auto &) -> int { return 1; }, 1.10);
+    auto painting = mito::mesh::metis::paint(mesh, n_partitions, constraints);
+    auto partitions = mito::mesh::metis::partition(mesh, n_partitions, constraints);
+
+    // expect two loads per partition
+    EXPECT_EQ(constraints.n_constraints, 2);
+    EXPECT_EQ(std::size(painting.loads), 2 * n_partitions);
+
+    // expect the partitions to match the loads of the first constraint and both constraints to
+    // be balanced
+    for (int part = 0; part < n_partitions; ++part) {
+        EXPECT_EQ(partitions[part].nCells(), painting.loads[2 * part]);
+        EXPECT_LE(painting.loads[2 * part], 1.2 * mesh.nCells() / n_partitions);
+        EXPECT_LE(painting.loads[2 * part + 1], 1.2 * mesh.nCells() / 2 / n_partitions);
+    }
+
+    // all done
+    return;
+}
+
+
+// end of file
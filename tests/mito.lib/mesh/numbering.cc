@@ -0,0 +1,55 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/mesh.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+
+TEST(Mesh, Numbering)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // generate a mesh of the unit square with 40 x 30 squares
+    auto mesh = mito::mesh::generators::rectangle(coord_system, 40, 30, { 0.0, 0.0 }, { 1.0, 1.0 });
+
+    // number the vertices of the mesh
+    auto numbering = mito::mesh::vertex_numbering(mesh);
+
+    // expect one number per vertex of the grid
+    EXPECT_EQ(numbering.size(), 41 * 31);
+    EXPECT_EQ(std::size(numbering.connectivity()), 3 * mesh.nCells());
+
+    // expect the numbers to be assigned in order of first appearance, and the nodes of each cell
+    // to share the vertex of the representative of their number
+    int next = 0;
+    int e = 0;
+    for (const auto & cell : mesh.cells()) {
+        for (int a = 0; a < 3; ++a) {
+            int n = numbering(e, a);
+            EXPECT_LE(n, next);
+            if (n == next) {
+                ++next;
+            }
+            EXPECT_EQ(numbering.node(n)->vertex(), cell.nodes()[a]->vertex());
+        }
+        ++e;
+    }
+    EXPECT_EQ(next, numbering.size());
+
+    // expect the nodes of the (continuous) mesh to be numbered as the vertices and the points
+    EXPECT_EQ(mito::mesh::node_numbering(mesh).connectivity(), numbering.connectivity());
+    EXPECT_EQ(mito::mesh::point_numbering(mesh).connectivity(), numbering.connectivity());
+
+    // all done
+    return;
+}
+
+
+// end of file
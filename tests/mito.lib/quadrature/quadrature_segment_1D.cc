@@ -45,4 +45,26 @@ TEST(Quadrature, Segment)
     EXPECT_NEAR(integral, (std::exp(1) - 1) / std::exp(1), 1.e-13);
 }
 
+
+TEST(Quadrature, SegmentRepeatedCells)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // a mesh of the segment (0, 1) with a geometrical duplicate
+    auto mesh = mito::mesh::mesh<mito::geometry::segment_t<1>>();
+    auto node_0 = mito::geometry::node(coord_system, { 0.0 });
+    auto node_1 = mito::geometry::node(coord_system, { 1.0 });
+    mesh.insert({ node_0, node_1 });
+    mesh.insert({ node_0, node_1 });
+
+    // an integrator on the segment (0, 1), counted twice
+    auto manifold = mito::manifolds::manifold(mesh, coord_system);
+    auto integrator = mito::quadrature::integrator<mito::quadrature::GAUSS, 2>(manifold);
+
+    // integrate exp(-x) on (0, 1), once per element
+    auto integral = integrator.integrate(mito::functions::exp(-x_0));
+    EXPECT_NEAR(integral, 2.0 * (std::exp(1) - 1) / std::exp(1), 1.e-13);
+}
+
 // end of file
@@ -0,0 +1,84 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/mesh.h>
+#include <mito/search.h>
+
+
+// cartesian coordinates in 2D
+using coordinates_t = mito::geometry::coordinates_t<2, mito::geometry::CARTESIAN>;
+
+
+TEST(Search, BVHPointLocation)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // an empty mesh of triangles in 2D
+    auto mesh = mito::mesh::mesh<mito::geometry::triangle_t<2>>();
+
+    // build the nodes of the unit square
+    auto node_0 = mito::geometry::node(coord_system, { 0.0, 0.0 });
+    auto node_1 = mito::geometry::node(coord_system, { 1.0, 0.0 });
+    auto node_2 = mito::geometry::node(coord_system, { 1.0, 1.0 });
+    auto node_3 = mito::geometry::node(coord_system, { 0.0, 1.0 });
+
+    // insert two triangles in the mesh (counterclockwise order)
+    mesh.insert({ node_0, node_1, node_2 });
+    mesh.insert({ node_0, node_2, node_3 });
+
+    // refine the mesh
+    auto tetra_mesh = mito::mesh::tetra(mesh, coord_system, 3);
+
+    // build the bounding volume hierarchy over the cells of the refined mesh
+    auto bvh = mito::search::bvh(tetra_mesh, coord_system);
+
+    // check that the hierarchy holds all the cells
+    EXPECT_EQ(bvh.size(), tetra_mesh.nCells());
+
+    // a collection of points in the square and one outside
+    std::vector<coordinates_t> points;
+    for (int i = 0; i < 20; ++i) {
+        for (int j = 0; j < 20; ++j) {
+            points.push_back({ (i + 0.5) / 20.0, (j + 0.25) / 20.0 });
+        }
+    }
+    points.push_back({ 2.0, 2.0 });
+
+    // locate all the points at once
+    auto locations = bvh.locate(points);
+
+    // the point outside the square is not found
+    EXPECT_EQ(locations.back().cell, -1);
+
+    // check that each point in the square is found and reconstructed by its parametric coordinates
+    for (int p = 0; p < std::ssize(points) - 1; ++p) {
+        const auto & [cell, xi] = locations[p];
+        EXPECT_NE(cell, -1);
+
+        // the location agrees with the single point query
+        EXPECT_EQ(bvh.locate(points[p]).cell, cell);
+
+        // reconstruct the point from the vertices of the cell
+        auto x = coord_system.coordinates(bvh.cell(cell).nodes()[2]->point());
+        auto x_0 = coord_system.coordinates(bvh.cell(cell).nodes()[0]->point());
+        auto x_1 = coord_system.coordinates(bvh.cell(cell).nodes()[1]->point());
+        auto y = x + xi[0] * (x_0 - x) + xi[1] * (x_1 - x);
+        EXPECT_NEAR(y[0], points[p][0], 1.0e-13);
+        EXPECT_NEAR(y[1], points[p][1], 1.0e-13);
+
+        // the parametric coordinates are barycentric coordinates in the cell
+        EXPECT_GE(xi[0], -1.0e-12);
+        EXPECT_GE(xi[1], -1.0e-12);
+        EXPECT_LE(xi[0] + xi[1], 1.0 + 1.0e-12);
+    }
+
+    // all done
+    return;
+}
+
+
+// end of file
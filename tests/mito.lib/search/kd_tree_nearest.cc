@@ -0,0 +1,75 @@
+// -*- c++ -*-
+//
+// Copyright (c) 2020-2026, the MiTo Authors, all rights reserved
+//
+
+#include <gtest/gtest.h>
+#include <mito/mesh.h>
+#include <mito/io.h>
+#include <mito/search.h>
+
+
+// cartesian coordinates in 3D
+using coordinates_t = mito::geometry::coordinates_t<3, mito::geometry::CARTESIAN>;
+
+
+TEST(Search, KdTreeNearest)
+{
+    // the coordinate system
+    auto coord_system = mito::geometry::coordinate_system<coordinates_t>();
+
+    // read the mesh of a ball
+    std::ifstream fileStream("ball.summit");
+    auto mesh =
+        mito::io::summit::reader<mito::geometry::tetrahedron_t<3>>(fileStream, coord_system);
+
+    // build the k-d tree over the nodes of the mesh
+    auto tree = mito::search::kd_tree(mesh, coord_system);
+
+    // a collection of query points
+    std::vector<coordinates_t> points;
+    for (int i = 0; i < 10; ++i) {
+        for (int j = 0; j < 10; ++j) {
+            points.push_back({ -1.0 + 0.21 * i, -1.0 + 0.19 * j, 0.1 * (i - j) });
+        }
+    }
+
+    // find the nearest node to each point at once
+    auto nearest = tree.nearest(points);
+
+    // the squared distance between node {i} of the tree and point {x}
+    auto distance2 = [&](int i, const coordinates_t & x) -> double {
+        const auto & y = coord_system.coordinates(tree.key(i)->point());
+        return (y[0] - x[0]) * (y[0] - x[0]) + (y[1] - x[1]) * (y[1] - x[1])
+             + (y[2] - x[2]) * (y[2] - x[2]);
+    };
+
+    // check against a brute force search
+    for (int p = 0; p < std::ssize(points); ++p) {
+        double best = std::numeric_limits<double>::max();
+        for (int i = 0; i < tree.size(); ++i) {
+            best = std::min(best, distance2(i, points[p]));
+        }
+        EXPECT_DOUBLE_EQ(distance2(nearest[p], points[p]), best);
+
+        // the nearest node is also found by the single point query
+        EXPECT_EQ(tree.nearest(points[p]), nearest[p]);
+    }
+
+    // the nodes within a ball around the origin are exactly those closer than the radius
+    coordinates_t origin = { 0.0, 0.0, 0.0 };
+    auto inside = tree.within(origin, 0.5);
+    int count = 0;
+    for (int i = 0; i < tree.size(); ++i) {
+        if (distance2(i, origin) <= 0.25) {
+            ++count;
+        }
+    }
+    EXPECT_EQ(std::ssize(inside), count);
+
+    // all done
+    return;
+}
+
+
+// end of file